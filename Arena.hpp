@@ -0,0 +1,21 @@
+#pragma once
+#include <memory_resource>
+
+/**
+* Arena
+*   The default storage of a Graph's vertices, adjacency lists and index: fixed-size slabs carved out of
+*   ever larger blocks, so that nodes built together lie together. Freed nodes are reused by later ones
+*   of the same size; everything is returned at once when the arena goes.
+*/
+class Arena {
+public:
+    Arena() = default;
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    std::pmr::memory_resource* Resource() { return &slabs; }
+
+private:
+    std::pmr::monotonic_buffer_resource blocks;
+    std::pmr::unsynchronized_pool_resource slabs{ &blocks };
+};
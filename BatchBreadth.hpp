@@ -0,0 +1,71 @@
+#pragma once
+#include "Traversal.hpp"
+#include "Bitset.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/**
+* BatchBreadth
+*   Breadth-first searches from many sources over one graph, 64 at a time: every vertex carries a word with a bit
+*   per search of the batch, so that each level scans the edges of a vertex once for all the searches it lies on
+*   the frontier of. Each edge u -> v passes the bits of u's frontier that v has not yet seen on to v.
+*   A source that is NoVertex reaches nothing.
+*
+*   for_each_edge(u, f) calls f(v) for every out-neighbour v of u;
+*   vertex(i) gives the handle of the vertex of index i (see VertexIndex).
+*/
+template <typename I, typename H, typename Edges, typename Handles>
+void BatchBreadth(BatchBfsResult<I, H>& r, const Edges& for_each_edge, const Handles& vertex)
+{
+    using Word = Bitset::Word;
+    const std::size_t n = r.dist.empty() ? 0 : r.dist.front().size();
+
+    std::vector<Word> seen(n);
+    std::vector<Word> frontier(n);
+    std::vector<Word> next(n);
+    std::vector<std::uint32_t> active;  // Vertices whose frontier word is non-zero.
+    std::vector<std::uint32_t> reached;
+    for (std::size_t first = 0; first < r.sources.size(); first += Bitset::word_bits) {
+        const std::size_t batch = std::min(Bitset::word_bits, r.sources.size() - first);
+        std::fill(seen.begin(), seen.end(), 0);
+        active.clear();
+        for (std::size_t b = 0; b < batch; ++b) {
+            if (r.sources[first + b] == NoVertex<H>()) {
+                continue;
+            }
+            const std::uint32_t k = VertexIndex(r.sources[first + b]);
+            if (!frontier[k]) {
+                active.push_back(k);
+            }
+            frontier[k] |= Word{ 1 } << b;
+            seen[k] |= Word{ 1 } << b;
+            r.dist[first + b][k] = 0;
+        }
+        for (int level = 1; !active.empty(); ++level) {
+            reached.clear();
+            for (std::uint32_t i : active) {
+                const Word f = frontier[i];
+                frontier[i] = 0;
+                for_each_edge(vertex(i), [&](H v) {
+                    const std::uint32_t k = VertexIndex(v);
+                    if (Word fresh = f & ~seen[k] & ~next[k]) {
+                        if (!next[k]) {
+                            reached.push_back(k);
+                        }
+                        next[k] |= fresh;
+                    }
+                });
+            }
+            for (std::uint32_t k : reached) {
+                seen[k] |= next[k];
+                for (Word bits = next[k]; bits; bits &= bits - 1) {
+                    r.dist[first + Bitset::LowestBit(bits)][k] = level;
+                }
+                frontier[k] = next[k];
+                next[k] = 0;
+            }
+            active.swap(reached);
+        }
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include "Traversal.hpp"
+#include "Bitset.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+* BidirectionalBreadth
+*   Point-to-point shortest path in edge count: breadth-first from source over the out-edges and from target
+*   over the in-edges, a whole level at a time, always growing the smaller frontier. Stops at the first level
+*   on which the frontiers meet, taking the shortest of the paths through the edges joining them.
+*   Returns source .. target, or an empty path if target is unreachable.
+*
+*   H is the vertex handle (see BfsResult) and n the number of vertices;
+*   for_each_out(u, f) calls f(v) for every out-neighbour v of u, for_each_in(v, f) f(u) for every in-neighbour u of v.
+*/
+template <typename H, typename Out, typename In>
+std::vector<H> BidirectionalBreadth(std::size_t n, H source, H target, const Out& for_each_out, const In& for_each_in)
+{
+    if (source == target) {
+        return { source };
+    }
+    struct Side {
+        Bitset seen;
+        std::vector<H> p;   // Towards the root of this side's search.
+        std::vector<std::uint32_t> dist;
+        std::vector<H> frontier;
+        std::vector<H> next;
+    };
+    Side fwd{ Bitset{ n }, std::vector<H>(n, NoVertex<H>()), std::vector<std::uint32_t>(n), { source }, {} };
+    Side bwd{ Bitset{ n }, std::vector<H>(n, NoVertex<H>()), std::vector<std::uint32_t>(n), { target }, {} };
+    fwd.seen.Set(VertexIndex(source));
+    bwd.seen.Set(VertexIndex(target));
+
+    // Edge u -> v (in forward orientation) joining the two searches through the fewest vertices.
+    H meet_u = NoVertex<H>();
+    H meet_v = NoVertex<H>();
+    auto expand = [&](Side& side, const Side& other, bool forward, const auto& for_each) {
+        side.next.clear();
+        std::uint32_t best = ~std::uint32_t{};
+        for (H u : side.frontier) {
+            for_each(u, [&](H v) {
+                const std::uint32_t k = VertexIndex(v);
+                if (other.seen.Test(k)) {
+                    // All of this level's vertices are equally deep on this side: rank by the other side alone.
+                    if (other.dist[k] < best) {
+                        best = other.dist[k];
+                        meet_u = forward ? u : v;
+                        meet_v = forward ? v : u;
+                    }
+                }
+                else if (!side.seen.TestAndSet(k)) {
+                    side.p[k] = u;
+                    side.dist[k] = side.dist[VertexIndex(u)] + 1;
+                    side.next.push_back(v);
+                }
+            });
+        }
+        side.frontier.swap(side.next);
+    };
+    while (!fwd.frontier.empty() && !bwd.frontier.empty() && meet_u == NoVertex<H>()) {
+        if (fwd.frontier.size() <= bwd.frontier.size()) {
+            expand(fwd, bwd, true, for_each_out);
+        }
+        else {
+            expand(bwd, fwd, false, for_each_in);
+        }
+    }
+    if (meet_u == NoVertex<H>()) {
+        return {};
+    }
+
+    std::vector<H> path;
+    for (H u = meet_u; u != NoVertex<H>(); u = fwd.p[VertexIndex(u)]) {
+        path.push_back(u);
+    }
+    std::vector<H> result{ path.rbegin(), path.rend() };
+    for (H v = meet_v; v != NoVertex<H>(); v = bwd.p[VertexIndex(v)]) {
+        result.push_back(v);
+    }
+    return result;
+}
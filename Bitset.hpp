@@ -0,0 +1,146 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BITSET_SSE2
+#endif
+
+/**
+* Bitset
+*   A dense set of vertex ids, one bit each, for visited sets and frontiers.
+*   Union and emptiness tests run a word (or, with SSE2, two words) at a time.
+*/
+class Bitset {
+public:
+    using Word = std::uint64_t;
+    static constexpr std::size_t word_bits = 64;
+
+    explicit Bitset(std::size_t n = 0) : words((n + word_bits - 1) / word_bits), n{ n } {}
+
+    bool Test(std::size_t i) const { return words[i / word_bits] >> (i % word_bits) & 1; }
+    void Set(std::size_t i) { words[i / word_bits] |= Word{ 1 } << (i % word_bits); }
+    void Reset(std::size_t i) { words[i / word_bits] &= ~(Word{ 1 } << (i % word_bits)); }
+    bool TestAndSet(std::size_t i);  // Returns the previous value.
+    void Clear() { words.assign(words.size(), 0); }
+
+    bool None() const;
+    std::size_t Count() const;
+    Bitset& operator|=(const Bitset& b);
+
+    template <typename F>
+    void ForEach(F f) const;    // Calls f(i) for every member i, in ascending order.
+
+    std::size_t Size() const { return n; }
+    std::size_t WordCount() const { return words.size(); }
+    Word WordAt(std::size_t w) const { return words[w]; }
+    void Swap(Bitset& b) { words.swap(b.words); std::swap(n, b.n); }
+
+    static int LowestBit(Word w);   // w != 0
+    static int PopCount(Word w);
+
+private:
+    std::vector<Word> words;
+    std::size_t n;
+};
+
+inline bool Bitset::TestAndSet(std::size_t i)
+{
+    Word& w = words[i / word_bits];
+    const Word bit = Word{ 1 } << (i % word_bits);
+    const bool was = w & bit;
+    w |= bit;
+    return was;
+}
+
+inline bool Bitset::None() const
+{
+    std::size_t w = 0;
+#ifdef BITSET_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; w + 2 <= words.size(); w += 2) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&words[w]));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(x, zero)) != 0xFFFF) {
+            return false;
+        }
+    }
+#endif
+    for (; w < words.size(); ++w) {
+        if (words[w]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline std::size_t Bitset::Count() const
+{
+    std::size_t count{};
+    for (Word w : words) {
+        count += PopCount(w);
+    }
+    return count;
+}
+
+inline Bitset& Bitset::operator|=(const Bitset& b)
+{
+    std::size_t w = 0;
+#ifdef BITSET_SSE2
+    for (; w + 2 <= words.size(); w += 2) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&words[w]));
+        __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&b.words[w]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&words[w]), _mm_or_si128(x, y));
+    }
+#endif
+    for (; w < words.size(); ++w) {
+        words[w] |= b.words[w];
+    }
+    return *this;
+}
+
+template <typename F>
+void Bitset::ForEach(F f) const
+{
+    for (std::size_t w = 0; w < words.size(); ++w) {
+        for (Word bits = words[w]; bits; bits &= bits - 1) {
+            f(w * word_bits + LowestBit(bits));
+        }
+    }
+}
+
+inline int Bitset::LowestBit(Word w)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned long i;
+    _BitScanForward64(&i, w);
+    return static_cast<int>(i);
+#elif defined(__GNUC__)
+    return __builtin_ctzll(w);
+#else
+    int i = 0;
+    for (; !(w & 1); w >>= 1) {
+        ++i;
+    }
+    return i;
+#endif
+}
+
+inline int Bitset::PopCount(Word w)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+    return static_cast<int>(__popcnt64(w));
+#elif defined(__GNUC__)
+    return __builtin_popcountll(w);
+#else
+    int count = 0;
+    for (; w; w &= w - 1) {
+        ++count;
+    }
+    return count;
+#endif
+}
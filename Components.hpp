@@ -0,0 +1,143 @@
+#pragma once
+#include "Traversal.hpp"
+#include "Bitset.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/**
+* Components
+*   The strongly connected components of a graph and its condensation.
+*   Components are numbered in topological order of the condensation: every edge between two
+*   components leads from a lower to a higher number. The condensation is stored as compressed
+*   sparse rows, without duplicate edges: the out-edges of component c are
+*   targets[offsets[c]] .. targets[offsets[c + 1] - 1].
+*/
+struct Components {
+    using Id = std::uint32_t;
+
+    Id Count() const { return static_cast<Id>(offsets.size() - 1); }
+    Id Of(Id v) const { return component[v]; }  // By vertex id.
+    const Id* EdgesBegin(Id c) const { return targets.data() + offsets[c]; }
+    const Id* EdgesEnd(Id c) const { return targets.data() + offsets[c + 1]; }
+
+    std::vector<Id> component;
+    std::vector<std::uint64_t> offsets;
+    std::vector<Id> targets;
+};
+
+/**
+* StronglyConnected
+*   Tarjan's algorithm in O(V + E), descending through an explicit stack rather than recursion.
+*   edges(v) gives, for the vertex of id v in [0, n), a range of handles to its out-neighbours
+*   (see VertexIndex).
+*/
+template <typename Edges>
+Components StronglyConnected(std::uint32_t n, const Edges& edges)
+{
+    using Id = Components::Id;
+    using Edge = decltype(edges(Id{}).begin());
+    struct Frame {
+        Id v;
+        Edge e;
+        Edge end;
+    };
+    constexpr Id unvisited = ~Id{};
+
+    Components c;
+    c.component.assign(n, 0);
+    std::vector<Id> index(n, unvisited);
+    std::vector<Id> low(n);
+    Bitset on_stack{ n };
+    std::vector<Id> S;
+    std::vector<Frame> frames;
+    Id next_index{};
+    Id count{};
+
+    auto discover = [&](Id v) {
+        index[v] = low[v] = next_index++;
+        S.push_back(v);
+        on_stack.Set(v);
+        auto&& range = edges(v);
+        frames.push_back({ v, range.begin(), range.end() });
+    };
+    for (Id root = 0; root < n; ++root) {
+        if (index[root] != unvisited) {
+            continue;
+        }
+        discover(root);
+        while (!frames.empty()) {
+            Frame& f = frames.back();
+            if (f.e != f.end) {
+                Id w = VertexIndex(*f.e);
+                ++f.e;
+                if (index[w] == unvisited) {
+                    discover(w);
+                }
+                else if (on_stack.Test(w)) {
+                    low[f.v] = std::min(low[f.v], index[w]);
+                }
+                continue;
+            }
+            const Id v = f.v;
+            frames.pop_back();
+            if (low[v] == index[v]) { // v roots a component: pop its members.
+                Id w;
+                do {
+                    w = S.back();
+                    S.pop_back();
+                    on_stack.Reset(w);
+                    c.component[w] = count;
+                } while (w != v);
+                ++count;
+            }
+            if (!frames.empty()) {
+                Id& parent_low = low[frames.back().v];
+                parent_low = std::min(parent_low, low[v]);
+            }
+        }
+    }
+
+    // Tarjan completes sink components first; reverse the numbering into topological order.
+    for (Id& k : c.component) {
+        k = count - 1 - k;
+    }
+
+    // Condensation: counting sort of the inter-component edges by source, dropping duplicates.
+    c.offsets.assign(count + 1, 0);
+    for (Id v = 0; v < n; ++v) {
+        for (auto u : edges(v)) {
+            if (c.component[VertexIndex(u)] != c.component[v]) {
+                ++c.offsets[c.component[v] + 1];
+            }
+        }
+    }
+    for (Id k = 0; k < count; ++k) {
+        c.offsets[k + 1] += c.offsets[k];
+    }
+    std::vector<Id> all(c.offsets[count]);
+    std::vector<std::uint64_t> cursor{ c.offsets.begin(), c.offsets.end() - 1 };
+    for (Id v = 0; v < n; ++v) {
+        for (auto u : edges(v)) {
+            if (Id k = c.component[VertexIndex(u)]; k != c.component[v]) {
+                all[cursor[c.component[v]]++] = k;
+            }
+        }
+    }
+    std::vector<Id> last(count, unvisited);   // Last source component to record an edge into each target.
+    c.targets.reserve(all.size());
+    std::uint64_t begin = 0;
+    for (Id k = 0; k < count; ++k) {
+        const std::uint64_t end = c.offsets[k + 1];
+        c.offsets[k] = c.targets.size();
+        for (std::uint64_t e = begin; e < end; ++e) {
+            if (last[all[e]] != k) {
+                last[all[e]] = k;
+                c.targets.push_back(all[e]);
+            }
+        }
+        begin = end;
+    }
+    c.offsets[count] = c.targets.size();
+    return c;
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include <cstddef>
+#include <memory_resource>
+
+/**
+* Counting
+*   A memory resource over new/delete that counts what passes through it: the blocks and bytes outstanding,
+*   and every allocation made. Shared by the tests and the benchmarks.
+*/
+struct Counting : std::pmr::memory_resource {
+    void* do_allocate(std::size_t n, std::size_t align) override { ++live; ++total; bytes += n; return upstream->allocate(n, align); }
+    void do_deallocate(void* p, std::size_t n, std::size_t align) override { --live; bytes -= n; upstream->deallocate(p, n, align); }
+    bool do_is_equal(const std::pmr::memory_resource& r) const noexcept override { return this == &r; }
+
+    std::pmr::memory_resource* upstream = std::pmr::new_delete_resource();
+    long live{};
+    long total{};
+    std::size_t bytes{};
+};
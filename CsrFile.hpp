@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+* Array
+*   A read-only view of n contiguous T over storage held elsewhere:
+*   the vectors a CsrGraph builds, or the pages of a mapped CsrFile.
+*/
+template <typename T>
+struct Array {
+    const T& operator[](std::size_t i) const { return first[i]; }
+    const T* data() const { return first; }
+    const T* begin() const { return first; }
+    const T* end() const { return first + n; }
+    std::size_t size() const { return n; }
+    bool empty() const { return n == 0; }
+
+    const T* first = nullptr;
+    std::size_t n = 0;
+};
+
+/**
+* CsrFile
+*   The on-disk form of a CsrGraph (see CsrGraph::Save() and CsrGraph::Open()): this header, then the sections
+*   it locates, each aligned to 64 bytes and in the writer's byte order --
+*       keys            |V| items, by vertex id
+*       slots           a power of two of vertex ids, at least twice |V|, placed by KeyHash of their item
+*                       and probed linearly; empty slots have all bits set
+*       offsets         |V| + 1
+*       neighbours      |E|
+*       in_offsets      |V| + 1
+*       in_neighbours   |E|
+*       weights         |E|, or empty if every edge weighs 1
+*   Items are stored, hashed and compared byte for byte, so an item must be Storable.
+*   A reader rejects a file whose magic, version, byte order or item size differ from its own.
+*/
+struct CsrFile {
+    enum Section { keys, slots, offsets, neighbours, in_offsets, in_neighbours, weights, sections };
+
+    static constexpr char signature[8] = { 'C', 'S', 'R', 'G', 'R', 'A', 'P', 'H' };
+    static constexpr std::uint32_t current_version = 1;
+    static constexpr std::uint32_t native_order = 0x01020304;
+    static constexpr std::uint64_t alignment = 64;
+
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint32_t key_size;
+    std::uint32_t reserved;
+    std::uint64_t vertices;
+    std::uint64_t edges;
+    std::uint64_t at[sections];     // Byte offset of each section from the start of the file.
+    std::uint64_t size[sections];   // Its length in bytes.
+};
+
+/**
+* Storable
+*   Whether a CsrFile can hold items of type I: those with a single object representation
+*   (std::has_unique_object_representations), as integers have -- but not pointers, which mean nothing
+*   to the process that reads the file.
+*/
+template <typename I>
+inline constexpr bool Storable = std::has_unique_object_representations_v<I> && !std::is_pointer_v<I>;
+
+/**
+* KeyHash
+*   FNV-1a over the bytes of an item: fixed by the file format, unlike std::hash, so that a file
+*   written by one build can be searched by another.
+*/
+template <typename I>
+std::uint64_t KeyHash(const I& item)
+{
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&item);
+    std::uint64_t h = 14695981039346656037ull;
+    for (std::size_t i = 0; i < sizeof(I); ++i) {
+        h = (h ^ bytes[i]) * 1099511628211ull;
+    }
+    return h;
+}
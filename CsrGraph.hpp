@@ -0,0 +1,630 @@
+#pragma once
+#include "Vertices.hpp"
+#include "GraphList.hpp"
+#include "Traversal.hpp"
+#include "ParallelBreadth.hpp"
+#include "MultiSourceBreadth.hpp"
+#include "BatchBreadth.hpp"
+#include "Components.hpp"
+#include "Dijkstra.hpp"
+#include "BidirectionalBreadth.hpp"
+#include "DenseIds.hpp"
+#include "CsrFile.hpp"
+#include "MappedFile.hpp"
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <memory>
+#include <optional>
+#include <string>
+#include <fstream>
+#include <cstring>
+#include <type_traits>
+
+/**
+* CsrGraph
+*   A read-only, compressed sparse row snapshot of a graph (see Graph::Freeze()).
+*   Vertices are numbered 0..V-1 in the order of the source graph's vertex set;
+*   the out-edges of vertex v are neighbours[offsets[v]] .. neighbours[offsets[v + 1] - 1],
+*   in the order the source graph iterates them. The transpose is kept alongside in the same layout.
+*   Edge weights, if the source graph has any, are kept in an array parallel to neighbours.
+*
+*   The arrays are shared, read-only, between copies: either built in memory, or the pages of a file written by
+*   Save() and mapped by Open(), which reads nothing up front and so takes the same time whatever the graph's size.
+*/
+template <typename I, typename Hash = ItemHash<I>, typename Equal = ItemEqual<I>>
+class CsrGraph {
+public:
+    using Id = std::uint32_t;
+    using Offset = std::uint64_t;
+    using Status = typename Vertex<I>::Status;
+    using BfsResult = BfsResult<I, Id>;
+    using MultiSourceBfsResult = MultiSourceBfsResult<I, Id>;
+    using BatchBfsResult = BatchBfsResult<I, Id>;
+    using DfsResult = DfsResult<I, Id>;
+    using DijkstraResult = DijkstraResult<I, Id>;
+
+    static constexpr Id none = NoVertex<Id>(); // Signals non-membership (Search) or an absent predecessor.
+
+    struct EdgeRange {
+        const Id* begin() const { return first; }
+        const Id* end() const { return last; }
+        const Id* first;
+        const Id* last;
+    };
+
+    template <typename Vs>
+    explicit CsrGraph(Vs& vertices);
+    /**
+    * FromEdges
+    *   Builds the snapshot straight from a flat array of count (source, target) pairs, without a Graph:
+    *   vertices are numbered in the order their items first appear, and the out-edges of each keep the given order.
+    */
+    static CsrGraph FromEdges(const std::pair<I, I>* edges, std::size_t count);
+    /**
+    * Open
+    *   Maps a file written by Save(), or returns nothing if it is missing or not a CsrFile of this item type.
+    *   The header and the bounds of each section are checked; their contents are trusted.
+    */
+    static std::optional<CsrGraph> Open(const std::string& path);
+    bool Save(const std::string& path) const;   // As a CsrFile; false on failure to write.
+
+    BfsResult Breadth(Id s) const;
+    BfsResult Breadth(Id s, ThreadPool&) const;     // Same result, levels expanded in parallel.
+    BfsResult Breadth(Id s, DirectionOptimizing) const; // Same distances; predecessors may differ.
+    MultiSourceBfsResult Breadth(const std::vector<Id>& sources) const;    // Distances from the nearest source.
+    BatchBfsResult BatchBreadth(const std::vector<Id>& sources) const;     // Distances from each source.
+    DfsResult Depth(Id s) const;
+    DijkstraResult Dijkstra(Id s, Id target = none) const;  // Stops once target is settled.
+    std::vector<Id> ShortestPath(Id s, Id v) const; // Runs Breadth(s).
+    std::vector<Id> ShortestPath(Id s, Id v, Bidirectional) const;  // Forward over the edges, backward over the transpose.
+    template <typename Heuristic>
+    std::vector<Id> AlternateShortestPath(Id s, Id v, const Heuristic& h) const; // A*: h(u) estimates the weight from u to v.
+    Components StronglyConnectedComponents() const;
+
+    Id Search(const I& item) const;
+    const I& Item(Id v) const { return items[v]; }
+    Id Size() const { return static_cast<Id>(items.size()); }
+    int InDegree(Id v) const { return static_cast<int>(in_offsets[v + 1] - in_offsets[v]); }
+    int OutDegree(Id v) const { return static_cast<int>(offsets[v + 1] - offsets[v]); }
+
+    const Id* EdgesBegin(Id v) const { return neighbours.data() + offsets[v]; }
+    const Id* EdgesEnd(Id v) const { return neighbours.data() + offsets[v + 1]; }
+    EdgeRange Edges(Id v) const { return { EdgesBegin(v), EdgesEnd(v) }; }
+    double Weight(Offset e) const { return weights.empty() ? 1 : weights[e]; }  // Of the edge neighbours[e].
+    const Id* InEdgesBegin(Id v) const { return in_neighbours.data() + in_offsets[v]; }
+    const Id* InEdgesEnd(Id v) const { return in_neighbours.data() + in_offsets[v + 1]; }
+
+private:
+    struct Owned {  // The arrays of a graph built in memory.
+        std::vector<Offset> offsets;
+        std::vector<Id> neighbours;
+        std::vector<Offset> in_offsets;
+        std::vector<Id> in_neighbours;
+        std::vector<double> weights;
+        std::vector<I> items;
+    };
+
+    CsrGraph() = default;
+    void Adopt(std::shared_ptr<Owned>);
+    static void BuildInEdges(Owned&);   // The transpose, by counting sort of the out-edges by target.
+    template <typename T>
+    static Array<T> View(const std::vector<T>& v) { return { v.data(), v.size() }; }
+
+    template <typename Heuristic>
+    DijkstraResult AStar(Id s, Id target, const Heuristic& h) const;
+
+    std::shared_ptr<const void> storage;   // Owned or MappedFile.
+    Array<Offset> offsets;  // |V| + 1
+    Array<Id> neighbours;   // |E|
+    Array<Offset> in_offsets;
+    Array<Id> in_neighbours;
+    Array<double> weights;  // |E|, or empty if every edge weighs 1.
+    Array<I> items;
+    Array<Id> slots;        // Item -> id as a CsrFile keeps it, if mapped;
+    std::unordered_map<I, Id, Hash, Equal> index;   // otherwise by Hash and Equal.
+};
+
+template <typename I, typename Hash, typename Equal>
+template <typename Vs>
+CsrGraph<I, Hash, Equal>::CsrGraph(Vs& vertices)
+{
+    const std::vector<Vertex<I>*>& set = vertices.set;
+    const Id n = static_cast<Id>(set.size());
+
+    auto g = std::make_shared<Owned>();    // A vertex's id is its position in set, and so its id here too.
+    g->items.reserve(n);
+    g->offsets.reserve(n + 1);
+    for (Vertex<I>* v : set) {
+        g->items.push_back(v->item);
+    }
+
+    g->offsets.push_back(0);
+    for (Vertex<I>* u : set) {
+        for (Vertex<I>* v : vertices[u]) {
+            g->neighbours.push_back(v->id);
+            if (vertices.Weighted()) {
+                g->weights.push_back(vertices.Weight(u, v));
+            }
+        }
+        g->offsets.push_back(g->neighbours.size());
+    }
+    g->neighbours.shrink_to_fit();
+    BuildInEdges(*g);
+    Adopt(std::move(g));
+}
+
+template <typename I, typename Hash, typename Equal>
+CsrGraph<I, Hash, Equal> CsrGraph<I, Hash, Equal>::FromEdges(const std::pair<I, I>* edges, std::size_t count)
+{
+    auto g = std::make_shared<Owned>();
+
+    // One hashing pass numbers the vertices and resolves both ends of every edge...
+    DenseIds<I, Hash, Equal> ids;
+    std::vector<Id> ends(2 * count);
+    for (std::size_t e = 0; e < count; ++e) { // A run of edges from one source hashes it once.
+        ends[2 * e] = e && Equal{}(edges[e].first, edges[e - 1].first) ? ends[2 * e - 2] : ids(edges[e].first);
+        ends[2 * e + 1] = ids(edges[e].second);
+    }
+    g->items = ids.Release();
+    const Id n = static_cast<Id>(g->items.size());
+
+    // ...and a counting sort by source lays out the rows.
+    g->offsets.assign(n + 1, 0);
+    for (std::size_t e = 0; e < count; ++e) {
+        ++g->offsets[ends[2 * e] + 1];
+    }
+    for (Id v = 0; v < n; ++v) {
+        g->offsets[v + 1] += g->offsets[v];
+    }
+    g->neighbours.resize(count);
+    std::vector<Offset> cursor{ g->offsets.begin(), g->offsets.end() - 1 };
+    for (std::size_t e = 0; e < count; ++e) {
+        g->neighbours[cursor[ends[2 * e]]++] = ends[2 * e + 1];
+    }
+    ends = {};
+    BuildInEdges(*g);
+
+    CsrGraph csr;
+    csr.Adopt(std::move(g));
+    return csr;
+}
+
+template <typename I, typename Hash, typename Equal>
+std::optional<CsrGraph<I, Hash, Equal>> CsrGraph<I, Hash, Equal>::Open(const std::string& path)
+{
+    static_assert(Storable<I>, "A CsrFile keeps items byte for byte.");
+
+    auto file = std::make_shared<MappedFile>(path);
+    CsrFile header;
+    if (!file->IsOpen() || file->Size() < sizeof header) {
+        return std::nullopt;
+    }
+    std::memcpy(&header, file->Data(), sizeof header);
+    if (std::memcmp(header.magic, CsrFile::signature, sizeof header.magic) != 0 || header.version != CsrFile::current_version
+        || header.byte_order != CsrFile::native_order || header.key_size != sizeof(I) || header.vertices >= none) {
+        return std::nullopt;
+    }
+
+    const std::uint64_t n = header.vertices;
+    const std::uint64_t m = header.edges;
+    const std::uint64_t slot_count = header.size[CsrFile::slots] / sizeof(Id);
+    const std::uint64_t expected[CsrFile::sections] = {
+        n * sizeof(I), slot_count * sizeof(Id), (n + 1) * sizeof(Offset), m * sizeof(Id), (n + 1) * sizeof(Offset), m * sizeof(Id),
+        header.size[CsrFile::weights] ? m * sizeof(double) : 0
+    };
+    if (slot_count <= n || (slot_count & (slot_count - 1)) != 0) {
+        return std::nullopt;
+    }
+    for (int k = 0; k < CsrFile::sections; ++k) {
+        if (header.size[k] != expected[k] || header.at[k] % CsrFile::alignment != 0
+            || header.at[k] > file->Size() || header.size[k] > file->Size() - header.at[k]) {
+            return std::nullopt;
+        }
+    }
+
+    CsrGraph g;
+    auto view = [&](auto& a, CsrFile::Section k) {
+        using T = std::remove_const_t<std::remove_pointer_t<decltype(a.data())>>;
+        a = { reinterpret_cast<const T*>(file->Data() + header.at[k]), header.size[k] / sizeof(T) };
+    };
+    view(g.items, CsrFile::keys);
+    view(g.slots, CsrFile::slots);
+    view(g.offsets, CsrFile::offsets);
+    view(g.neighbours, CsrFile::neighbours);
+    view(g.in_offsets, CsrFile::in_offsets);
+    view(g.in_neighbours, CsrFile::in_neighbours);
+    view(g.weights, CsrFile::weights);
+    g.storage = std::move(file);
+    return g;
+}
+
+template <typename I, typename Hash, typename Equal>
+bool CsrGraph<I, Hash, Equal>::Save(const std::string& path) const
+{
+    static_assert(Storable<I>, "A CsrFile keeps items byte for byte.");
+
+    std::size_t capacity = 16;
+    while (capacity < 2 * static_cast<std::size_t>(Size())) {
+        capacity <<= 1;
+    }
+    std::vector<Id> table(capacity, none);
+    for (Id v = 0; v < Size(); ++v) {
+        std::size_t k = KeyHash(items[v]) & (capacity - 1);
+        while (table[k] != none) {
+            k = (k + 1) & (capacity - 1);
+        }
+        table[k] = v;
+    }
+
+    CsrFile header{};
+    std::memcpy(header.magic, CsrFile::signature, sizeof header.magic);
+    header.version = CsrFile::current_version;
+    header.byte_order = CsrFile::native_order;
+    header.key_size = sizeof(I);
+    header.vertices = Size();
+    header.edges = neighbours.size();
+    const char* data[CsrFile::sections] = {
+        reinterpret_cast<const char*>(items.data()), reinterpret_cast<const char*>(table.data()),
+        reinterpret_cast<const char*>(offsets.data()), reinterpret_cast<const char*>(neighbours.data()),
+        reinterpret_cast<const char*>(in_offsets.data()), reinterpret_cast<const char*>(in_neighbours.data()),
+        reinterpret_cast<const char*>(weights.data())
+    };
+    const std::uint64_t sizes[CsrFile::sections] = {
+        items.size() * sizeof(I), table.size() * sizeof(Id), offsets.size() * sizeof(Offset), neighbours.size() * sizeof(Id),
+        in_offsets.size() * sizeof(Offset), in_neighbours.size() * sizeof(Id), weights.size() * sizeof(double)
+    };
+    std::uint64_t at = sizeof header;
+    for (int k = 0; k < CsrFile::sections; ++k) {
+        at = (at + CsrFile::alignment - 1) / CsrFile::alignment * CsrFile::alignment;
+        header.at[k] = at;
+        header.size[k] = sizes[k];
+        at += sizes[k];
+    }
+
+    std::ofstream out{ path, std::ios::binary | std::ios::trunc };
+    out.write(reinterpret_cast<const char*>(&header), sizeof header);
+    std::uint64_t written = sizeof header;
+    const char padding[CsrFile::alignment] = {};
+    for (int k = 0; k < CsrFile::sections; ++k) {
+        out.write(padding, static_cast<std::streamsize>(header.at[k] - written));
+        out.write(data[k], static_cast<std::streamsize>(header.size[k]));
+        written = header.at[k] + header.size[k];
+    }
+    return static_cast<bool>(out.flush());
+}
+
+template <typename I, typename Hash, typename Equal>
+void CsrGraph<I, Hash, Equal>::Adopt(std::shared_ptr<Owned> g)
+{
+    offsets = View(g->offsets);
+    neighbours = View(g->neighbours);
+    in_offsets = View(g->in_offsets);
+    in_neighbours = View(g->in_neighbours);
+    weights = View(g->weights);
+    items = View(g->items);
+    index.reserve(items.size());
+    for (Id v = 0; v < Size(); ++v) {
+        index.emplace(items[v], v);
+    }
+    storage = std::move(g);
+}
+
+template <typename I, typename Hash, typename Equal>
+void CsrGraph<I, Hash, Equal>::BuildInEdges(Owned& g)
+{
+    const Id n = static_cast<Id>(g.items.size());
+    g.in_offsets.assign(n + 1, 0);
+    for (Id v : g.neighbours) {
+        ++g.in_offsets[v + 1];
+    }
+    for (Id v = 0; v < n; ++v) {
+        g.in_offsets[v + 1] += g.in_offsets[v];
+    }
+    g.in_neighbours.resize(g.neighbours.size());
+    std::vector<Offset> cursor{ g.in_offsets.begin(), g.in_offsets.end() - 1 };
+    for (Id u = 0; u < n; ++u) {
+        for (Offset e = g.offsets[u]; e != g.offsets[u + 1]; ++e) {
+            g.in_neighbours[cursor[g.neighbours[e]]++] = u;
+        }
+    }
+}
+
+template <typename I, typename Hash, typename Equal>
+BfsResult<I, std::uint32_t> CsrGraph<I, Hash, Equal>::Breadth(Id source) const
+{
+    BfsResult r{ Size() };
+    if (source >= Size()) {
+        return r;
+    }
+    auto& s = r.s;
+    auto& dist = r.dist;
+    auto& p = r.p;
+    s[source] = Status::f;
+    dist[source] = 0;
+    Bitset visited{ Size() };
+    visited.Set(source);
+    std::vector<Id> Q;  // Every vertex is enqueued at most once.
+    Q.reserve(Size());
+    Q.push_back(source);
+    for (std::size_t head = 0; head < Q.size(); ++head) {
+        Id u = Q[head];
+        for (const Id* e = EdgesBegin(u), *end = EdgesEnd(u); e != end; ++e) {
+            if (Id v = *e; !visited.TestAndSet(v)) {
+                p[v] = u;
+                dist[v] = dist[u] + 1;
+                s[v] = Status::f;
+                Q.push_back(v);
+            }
+        }
+        s[u] = Status::d;
+    }
+    return r;
+}
+
+template <typename I, typename Hash, typename Equal>
+MultiSourceBfsResult<I, std::uint32_t> CsrGraph<I, Hash, Equal>::Breadth(const std::vector<Id>& sources) const
+{
+    MultiSourceBfsResult r{ Size() };
+    std::vector<Id> seeds;
+    seeds.reserve(sources.size());
+    std::copy_if(sources.begin(), sources.end(), std::back_inserter(seeds), [this](Id s) { return s < Size(); });
+    MultiSourceBreadth(r, seeds, [this](Id u, auto&& visit) {
+        for (const Id* e = EdgesBegin(u), *end = EdgesEnd(u); e != end; ++e) {
+            visit(*e);
+        }
+    });
+    return r;
+}
+
+template <typename I, typename Hash, typename Equal>
+BatchBfsResult<I, std::uint32_t> CsrGraph<I, Hash, Equal>::BatchBreadth(const std::vector<Id>& sources) const
+{
+    std::vector<Id> valid(sources.size());
+    std::transform(sources.begin(), sources.end(), valid.begin(), [this](Id s) { return s < Size() ? s : none; });
+    BatchBfsResult r{ Size(), std::move(valid) };
+    ::BatchBreadth(r, [this](Id u, auto&& visit) {
+        for (const Id* e = EdgesBegin(u), *end = EdgesEnd(u); e != end; ++e) {
+            visit(*e);
+        }
+    }, [](std::uint32_t i) { return i; });
+    return r;
+}
+
+template <typename I, typename Hash, typename Equal>
+BfsResult<I, std::uint32_t> CsrGraph<I, Hash, Equal>::Breadth(Id source, ThreadPool& pool) const
+{
+    BfsResult r{ Size() };
+    if (source < Size()) {
+        ParallelBreadth(r, source, [this](Id u, auto&& visit) {
+            for (const Id* e = EdgesBegin(u), *end = EdgesEnd(u); e != end; ++e) {
+                visit(*e);
+            }
+        }, pool);
+    }
+    return r;
+}
+
+/**
+*   Expands top-down while the frontier is small, and bottom-up -- each unfound vertex scanning its
+*   in-edges for a parent in the frontier -- while the frontier is large.
+*/
+template <typename I, typename Hash, typename Equal>
+BfsResult<I, std::uint32_t> CsrGraph<I, Hash, Equal>::Breadth(Id source, DirectionOptimizing params) const
+{
+    BfsResult r{ Size() };
+    if (source >= Size()) {
+        return r;
+    }
+    auto& s = r.s;
+    auto& dist = r.dist;
+    auto& p = r.p;
+    const Id n = Size();
+    Offset unexplored = neighbours.size() - OutDegree(source);    // Out-edges of unfound vertices.
+    s[source] = Status::f;
+    dist[source] = 0;
+    Bitset visited{ n };
+    visited.Set(source);
+
+    std::vector<Id> queue{ source };    // Frontier, while top-down.
+    Bitset in_frontier;                 // Frontier, while bottom-up.
+    std::size_t frontier_size = 1;
+    bool bottom_up = false;
+    for (int level = 1; frontier_size; ++level) {
+        if (!bottom_up) {
+            Offset frontier_edges{};
+            for (Id u : queue) {
+                frontier_edges += OutDegree(u);
+            }
+            if (frontier_edges > unexplored / params.alpha) {
+                bottom_up = true;
+                in_frontier = Bitset{ n };
+                for (Id u : queue) {
+                    in_frontier.Set(u);
+                }
+            }
+        }
+        else if (frontier_size < n / params.beta) {
+            bottom_up = false;
+            queue.clear();
+            in_frontier.ForEach([&](std::size_t u) { queue.push_back(static_cast<Id>(u)); });
+        }
+
+        if (bottom_up) {
+            Bitset next{ n };
+            in_frontier.ForEach([&](std::size_t u) { s[u] = Status::d; });
+            for (std::size_t w = 0; w < visited.WordCount(); ++w) {
+                // Scans the unfound vertices a word at a time, skipping words found entirely.
+                for (Bitset::Word unfound = ~visited.WordAt(w); unfound; unfound &= unfound - 1) {
+                    const Id v = static_cast<Id>(w * Bitset::word_bits + Bitset::LowestBit(unfound));
+                    if (v >= n) {
+                        break;
+                    }
+                    for (const Id* e = InEdgesBegin(v), *end = InEdgesEnd(v); e != end; ++e) {
+                        if (in_frontier.Test(*e)) {
+                            p[v] = *e;
+                            dist[v] = level;
+                            s[v] = Status::f;
+                            next.Set(v);
+                            unexplored -= OutDegree(v);
+                            break;
+                        }
+                    }
+                }
+            }
+            visited |= next;
+            frontier_size = next.Count();
+            in_frontier.Swap(next);
+        }
+        else {
+            std::vector<Id> next;
+            for (Id u : queue) {
+                for (const Id* e = EdgesBegin(u), *end = EdgesEnd(u); e != end; ++e) {
+                    if (Id v = *e; !visited.TestAndSet(v)) {
+                        p[v] = u;
+                        dist[v] = level;
+                        s[v] = Status::f;
+                        next.push_back(v);
+                        unexplored -= OutDegree(v);
+                    }
+                }
+                s[u] = Status::d;
+            }
+            queue.swap(next);
+            frontier_size = queue.size();
+        }
+    }
+    return r;
+}
+
+/**
+*   Visits the source first, then every vertex following it that remains undiscovered.
+*/
+template <typename I, typename Hash, typename Equal>
+DfsResult<I, std::uint32_t> CsrGraph<I, Hash, Equal>::Depth(Id source) const
+{
+    DfsResult r{ Size() };
+    if (source >= Size()) {
+        return r;
+    }
+    auto& s = r.s;
+    auto& t_found = r.t_found;
+    auto& t_disc = r.t_disc;
+    auto& p = r.p;
+    int time{};
+    Bitset visited{ Size() };
+    std::vector<std::pair<Id, Offset>> stack; // (Vertex, next edge to examine)
+    for (Id root = source; root < Size(); ++root) {
+        if (visited.TestAndSet(root)) {
+            continue;
+        }
+        t_found[root] = ++time;
+        s[root] = Status::f;
+        stack.emplace_back(root, offsets[root]);
+        while (!stack.empty()) {
+            auto& [u, e] = stack.back();
+            if (e != offsets[u + 1]) {
+                if (Id v = neighbours[e++]; !visited.TestAndSet(v)) {
+                    p[v] = u;
+                    t_found[v] = ++time;
+                    s[v] = Status::f;
+                    stack.emplace_back(v, offsets[v]);
+                }
+            }
+            else {
+                t_disc[u] = ++time;
+                s[u] = Status::d;
+                stack.pop_back();
+            }
+        }
+    }
+    return r;
+}
+
+template <typename I, typename Hash, typename Equal>
+std::vector<typename CsrGraph<I, Hash, Equal>::Id> CsrGraph<I, Hash, Equal>::ShortestPath(Id source, Id v) const
+{
+    if (source < Size() && v < Size()) {
+        return Breadth(source).ShortestPath(source, v);
+    }
+    return {};
+}
+
+template <typename I, typename Hash, typename Equal>
+std::vector<typename CsrGraph<I, Hash, Equal>::Id> CsrGraph<I, Hash, Equal>::ShortestPath(Id source, Id v, Bidirectional) const
+{
+    if (source < Size() && v < Size()) {
+        return BidirectionalBreadth(Size(), source, v,
+            [this](Id u, auto&& f) {
+                for (const Id* w = EdgesBegin(u); w != EdgesEnd(u); ++w) {
+                    f(*w);
+                }
+            },
+            [this](Id w, auto&& f) {
+                for (const Id* u = InEdgesBegin(w); u != InEdgesEnd(w); ++u) {
+                    f(*u);
+                }
+            });
+    }
+    return {};
+}
+
+template <typename I, typename Hash, typename Equal>
+DijkstraResult<I, std::uint32_t> CsrGraph<I, Hash, Equal>::Dijkstra(Id source, Id target) const
+{
+    return AStar(source, target, [](Id) { return 0.0; });
+}
+
+template <typename I, typename Hash, typename Equal>
+template <typename Heuristic>
+std::vector<typename CsrGraph<I, Hash, Equal>::Id> CsrGraph<I, Hash, Equal>::AlternateShortestPath(Id source, Id v, const Heuristic& h) const
+{
+    if (source < Size() && v < Size()) {
+        return AStar(source, v, h).ShortestPath(source, v);
+    }
+    return {};
+}
+
+template <typename I, typename Hash, typename Equal>
+template <typename Heuristic>
+DijkstraResult<I, std::uint32_t> CsrGraph<I, Hash, Equal>::AStar(Id source, Id target, const Heuristic& h) const
+{
+    DijkstraResult r{ Size() };
+    if (source < Size()) {
+        ::AStar(r, source, target, [this](Id u, auto&& relax) {
+            for (Offset e = offsets[u]; e != offsets[u + 1]; ++e) {
+                relax(neighbours[e], Weight(e));
+            }
+        }, [](std::uint32_t i) { return i; }, h);
+    }
+    return r;
+}
+
+template <typename I, typename Hash, typename Equal>
+Components CsrGraph<I, Hash, Equal>::StronglyConnectedComponents() const
+{
+    return StronglyConnected(Size(), [this](Id v) { return Edges(v); });
+}
+
+template <typename I, typename Hash, typename Equal>
+typename CsrGraph<I, Hash, Equal>::Id CsrGraph<I, Hash, Equal>::Search(const I& item) const
+{
+    if constexpr (Storable<I>) {
+        if (!slots.empty()) {
+            const std::size_t mask = slots.size() - 1;
+            for (std::size_t k = KeyHash(item) & mask; slots[k] != none; k = (k + 1) & mask) {
+                if (std::memcmp(&items[slots[k]], &item, sizeof(I)) == 0) {
+                    return slots[k];
+                }
+            }
+            return none;
+        }
+    }
+    if (auto it = index.find(item); it != index.end()) {
+        return it->second;
+    }
+    return none;
+}
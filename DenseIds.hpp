@@ -0,0 +1,87 @@
+#pragma once
+#include "Vertices.hpp"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+* DenseIds
+*   Numbers items 0, 1, 2, ... in the order they are first seen, for the bulk builders (see Graph::AddEdges()).
+*   An open-addressing table probed linearly, holding each item next to its id, so that a lookup costs about
+*   one cache line where a node-based map chases a pointer per bucket. Kept at most half full.
+*/
+template <typename I, typename Hash = ItemHash<I>, typename Equal = ItemEqual<I>>
+class DenseIds {
+public:
+    using Id = std::uint32_t;
+
+    static constexpr Id none = ~Id{};   // Signals non-membership (Find).
+
+    explicit DenseIds(std::size_t expected = 0);
+
+    Id operator()(const I& item);   // The id of item, numbering it if new.
+    Id Find(const I& item) const { return slots[Slot(item)].second; }
+    Id Size() const { return static_cast<Id>(items.size()); }
+    const I& Item(Id k) const { return items[k]; }
+    std::vector<I> Release() { slots = {}; return std::move(items); }  // The items by id.
+
+private:
+    std::size_t Slot(const I& item) const;
+    void Grow();
+
+    std::vector<std::pair<I, Id>> slots;    // A power of two of them.
+    std::vector<I> items;
+    Hash hash;
+    Equal equal;
+};
+
+template <typename I, typename Hash, typename Equal>
+DenseIds<I, Hash, Equal>::DenseIds(std::size_t expected)
+{
+    std::size_t capacity = 16;
+    while (capacity < 2 * expected) {
+        capacity <<= 1;
+    }
+    slots.assign(capacity, { I{}, none });
+    items.reserve(expected);
+}
+
+template <typename I, typename Hash, typename Equal>
+typename DenseIds<I, Hash, Equal>::Id DenseIds<I, Hash, Equal>::operator()(const I& item)
+{
+    std::size_t k = Slot(item);
+    if (slots[k].second != none) {
+        return slots[k].second;
+    }
+    const Id id = Size();
+    slots[k] = { item, id };
+    items.push_back(item);
+    if (2 * items.size() > slots.size()) {
+        Grow();
+    }
+    return id;
+}
+
+template <typename I, typename Hash, typename Equal>
+std::size_t DenseIds<I, Hash, Equal>::Slot(const I& item) const
+{
+    // Fibonacci hashing spreads the identity hashes of small integers over the whole table.
+    const std::size_t mask = slots.size() - 1;
+    std::size_t k = static_cast<std::size_t>((static_cast<std::uint64_t>(hash(item)) * 11400714819323198485ull) >> 32) & mask;
+    while (slots[k].second != none && !equal(slots[k].first, item)) {
+        k = (k + 1) & mask;
+    }
+    return k;
+}
+
+template <typename I, typename Hash, typename Equal>
+void DenseIds<I, Hash, Equal>::Grow()
+{
+    std::vector<std::pair<I, Id>> old(2 * slots.size(), { I{}, none });
+    old.swap(slots);
+    for (auto& [item, id] : old) {
+        if (id != none) {
+            slots[Slot(item)] = { std::move(item), id };
+        }
+    }
+}
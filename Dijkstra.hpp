@@ -0,0 +1,58 @@
+#pragma once
+#include "Traversal.hpp"
+#include "IndexedHeap.hpp"
+#include <cstdint>
+
+/**
+* AStar
+*   Shortest paths over non-negative edge weights, settling vertices in order of dist + heuristic(v)
+*   from an indexed binary heap with decrease-key. Stops as soon as target is settled, unless target is NoVertex.
+*   heuristic(v) must not overestimate the distance from v to target; a vertex is settled again if a shorter
+*   path to it turns up later, which only an inconsistent heuristic allows.
+*
+*   for_each_edge(u, f) calls f(v, w) for every out-edge u -> v of weight w;
+*   vertex(i) gives the handle of the vertex of index i (see VertexIndex).
+*/
+template <typename I, typename H, typename Edges, typename Handles, typename Heuristic>
+void AStar(DijkstraResult<I, H>& r, H source, H target, const Edges& for_each_edge, const Handles& vertex, const Heuristic& heuristic)
+{
+    using Status = typename DijkstraResult<I, H>::Status;
+
+    IndexedHeap<double> Q{ r.s.size() };
+    r.dist[VertexIndex(source)] = 0;
+    r.s[VertexIndex(source)] = Status::f;
+    Q.Push(VertexIndex(source), heuristic(source));
+    while (!Q.Empty()) {
+        const std::uint32_t i = Q.Pop().first;
+        const double d = r.dist[i];
+        H u = vertex(i);
+        r.s[i] = Status::d;
+        if (u == target) {
+            return;
+        }
+        for_each_edge(u, [&](H v, double w) {
+            const std::uint32_t k = VertexIndex(v);
+            if (d + w < r.dist[k]) {
+                r.dist[k] = d + w;
+                r.p[k] = u;
+                if (Q.Contains(k)) {
+                    Q.DecreaseKey(k, d + w + heuristic(v));
+                }
+                else {
+                    r.s[k] = Status::f;
+                    Q.Push(k, d + w + heuristic(v));
+                }
+            }
+        });
+    }
+}
+
+/**
+* Dijkstra
+*   AStar without a heuristic: every vertex is settled once, in order of distance from source.
+*/
+template <typename I, typename H, typename Edges, typename Handles>
+void Dijkstra(DijkstraResult<I, H>& r, H source, H target, const Edges& for_each_edge, const Handles& vertex)
+{
+    AStar(r, source, target, for_each_edge, vertex, [](H) { return 0.0; });
+}
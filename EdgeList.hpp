@@ -0,0 +1,138 @@
+#pragma once
+#include "ThreadPool.hpp"
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+/**
+* EdgeListStats
+*   What ReadEdgeList() made of a file.
+*/
+struct EdgeListStats {
+    bool opened = false;
+    std::uint64_t edges = 0;
+    std::uint64_t malformed = 0;    // Lines skipped for want of two well-formed items.
+};
+
+/**
+* ParseItem
+*   The default item parser of ReadEdgeList(): a number, converted in place by std::from_chars.
+*/
+template <typename I>
+bool ParseItem(const char* first, const char* last, I& item)
+{
+    auto [end, error] = std::from_chars(first, last, item);
+    return error == std::errc{} && end == last;
+}
+
+/**
+* ReadEdgeList
+*   Streams a text file of edges, one "source target" per line, the two separated by blanks and/or a comma;
+*   further columns are ignored, as are blank lines and lines starting with '#'.
+*   The file is read chunk_size bytes at a time, and each chunk, up to its last line break, cut into one piece per
+*   worker of pool; the pieces are tokenized and parsed in place, in parallel, and their edges handed in file order
+*   to sink(const std::pair<I, I>* edges, std::size_t count) on the calling thread -- Graph::AddEdges(), say.
+*   Memory stays within the chunk and its parsed edges, whatever the size of the file; a line longer than
+*   a chunk grows it.
+*
+*   parse(first, last, item) converts the token [first, last) into item, returning false if it is malformed.
+*   It runs on several threads at once. Items may point into the chunk, as a std::string_view of the token does:
+*   the chunk stays put until sink returns, which can then intern them (see Interner).
+*/
+template <typename I, typename Sink, typename Parse = bool (*)(const char*, const char*, I&)>
+EdgeListStats ReadEdgeList(const std::string& path, ThreadPool& pool, const Sink& sink,
+                           std::size_t chunk_size = std::size_t{ 1 } << 24, const Parse& parse = ParseItem<I>)
+{
+    EdgeListStats stats;
+    std::ifstream in{ path, std::ios::binary };
+    if (!in) {
+        return stats;
+    }
+    stats.opened = true;
+
+    const unsigned pieces = pool.Size();
+    std::vector<char> buffer(chunk_size ? chunk_size : 1);
+    std::vector<std::vector<std::pair<I, I>>> edges(pieces);
+    std::vector<std::uint64_t> malformed(pieces);
+    std::size_t carried = 0;    // Bytes of an unfinished line moved to the front of the buffer.
+    for (bool last = false; !last;) {
+        in.read(buffer.data() + carried, static_cast<std::streamsize>(buffer.size() - carried));
+        const std::size_t filled = carried + static_cast<std::size_t>(in.gcount());
+        last = filled < buffer.size();
+        std::size_t end = filled;
+        if (!last) {
+            while (end && buffer[end - 1] != '\n') {
+                --end;
+            }
+            if (!end) { // Not one whole line: read on into a larger buffer.
+                carried = filled;
+                buffer.resize(2 * buffer.size());
+                continue;
+            }
+        }
+
+        // Piece k starts after the first line break at or beyond k / pieces of the way through the chunk.
+        const char* chunk = buffer.data();
+        auto boundary = [&](unsigned k) -> std::size_t {
+            if (k == 0 || k == pieces) {
+                return k == 0 ? 0 : end;
+            }
+            const std::size_t from = end * k / pieces;
+            const void* nl = std::memchr(chunk + from, '\n', end - from);
+            return nl ? static_cast<const char*>(nl) - chunk + 1 : end;
+        };
+        pool.Run([&](unsigned w) {
+            auto blank = [](char c) { return c == ' ' || c == '\t' || c == '\r'; };
+            auto token_end = [&](const char* p, const char* eol) {
+                while (p != eol && !blank(*p) && *p != ',') {
+                    ++p;
+                }
+                return p;
+            };
+            edges[w].clear();
+            malformed[w] = 0;
+            const char* p = chunk + boundary(w);
+            const char* piece_end = chunk + boundary(w + 1);
+            while (p < piece_end) {
+                const char* nl = static_cast<const char*>(std::memchr(p, '\n', piece_end - p));
+                const char* eol = nl ? nl : piece_end;
+                while (p != eol && blank(*p)) {
+                    ++p;
+                }
+                if (p != eol && *p != '#') {
+                    const char* source_end = token_end(p, eol);
+                    const char* q = source_end;
+                    while (q != eol && (blank(*q) || *q == ',')) {
+                        ++q;
+                    }
+                    const char* target_end = token_end(q, eol);
+                    I source;
+                    I target;
+                    if (q != target_end && parse(p, source_end, source) && parse(q, target_end, target)) {
+                        edges[w].emplace_back(std::move(source), std::move(target));
+                    }
+                    else {
+                        ++malformed[w];
+                    }
+                }
+                p = eol + 1;
+            }
+        });
+        for (unsigned w = 0; w < pieces; ++w) {
+            if (!edges[w].empty()) {
+                sink(static_cast<const std::pair<I, I>*>(edges[w].data()), edges[w].size());
+            }
+            stats.edges += edges[w].size();
+            stats.malformed += malformed[w];
+        }
+
+        carried = filled - end;
+        std::memmove(buffer.data(), buffer.data() + end, carried);
+    }
+    return stats;
+}
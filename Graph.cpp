@@ -4,17 +4,6 @@
 #include <fstream>  // Debug
 #include <assert.h>
 
-template <typename I>
-HNode<V, I> TestVertex()
-{
-    List<V, I> list{};
-    I item = I{};
-    HNode<V, I> n = Acquire<V, I>::Instance(std::move(item));
-    list.Insert(n.Release());
-    auto new_list { std::move(list) };
-    return new_list.Release(I{});
-}
-
 template <typename I>
 Graph<I> DebugGraph(std::vector<std::vector<I>>& vertices, const std::string& output = {})
 {
@@ -23,12 +12,12 @@ Graph<I> DebugGraph(std::vector<std::vector<I>>& vertices, const std::string& ou
     if (std::ofstream ofs{ output, std::ios::app }) {
         // Comparison of g before and after a call to Transpose()
         auto vs = g.VertexSet();
-        g.Breadth(vs[1]);
+        g.BreadthInPlace(vs[1]);
         g.Summarize(ofs);
         
         g.Transpose();
         
-        g.Breadth(vs[1]);
+        g.BreadthInPlace(vs[1]);
         g.Summarize(ofs);
     }
 
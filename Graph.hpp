@@ -1,220 +1,638 @@
 #pragma once
 #include "Vertices.hpp"
+#include "Arena.hpp"
 #include "GraphList.hpp"
 #include "Queue.hpp"
+#include "CsrGraph.hpp"
+#include "Traversal.hpp"
+#include "ParallelBreadth.hpp"
+#include "MultiSourceBreadth.hpp"
+#include "BatchBreadth.hpp"
+#include "Components.hpp"
+#include "Dijkstra.hpp"
+#include "BidirectionalBreadth.hpp"
+#include "DenseIds.hpp"
+#include "EdgeList.hpp"
+#include "Interner.hpp"
 #include <vector>
+#include <utility>
+#include <algorithm>
+#include <memory>
+#include <type_traits>
 #include <iostream> // Debug
 
 template <typename T>
 using V = Vertex<T>;
 
-template <typename I>
+/**
+* Graph
+*   Hash and Equal key the item -> vertex index (see Vertices).
+*
+*   Breadth() and Depth() return their state as a BfsResult/DfsResult and leave the graph untouched,
+*   so any number of threads may traverse one graph concurrently;
+*   BreadthInPlace() and DepthInPlace() record that state in each Vertex (s, dist, t_found, t_disc, p) instead.
+*   BreadthInPlace(s, Dynamic{}) records it in the same way, then keeps dist and p current through AddVertex(), AddEdge(),
+*   RemoveEdge(), RemoveVertex() and Transpose() until the next BreadthInPlace() or DepthInPlace(), or the removal of s.
+*/
+template <typename I, typename Hash = ItemHash<I>, typename Equal = ItemEqual<I>>
 class Graph {
 public:
     using Vertex = Vertex<I>;
-    using Vertices = Vertices<I>;
+    using Vertices = Vertices<I, Hash, Equal>;
+    using BfsResult = BfsResult<I, Vertex*>;
+    using MultiSourceBfsResult = MultiSourceBfsResult<I, Vertex*>;
+    using BatchBfsResult = BatchBfsResult<I, Vertex*>;
+    using DfsResult = DfsResult<I, Vertex*>;
+    using DijkstraResult = DijkstraResult<I, Vertex*>;
 
     /**
     * @param lists
     *   A set of lists, each containing a set of vertices signaling the direct descendancy of each one to the first.
+    * @param resource
+    *   Storage for the vertices, edges and index, which must outlive the graph; by default an Arena of the graph's own.
     */
-    Graph(const std::vector<std::vector<I>>& lists) noexcept;
+    Graph(const std::vector<std::vector<I>>& lists, std::pmr::memory_resource* resource = nullptr) noexcept;
+    /**
+    * @param edges, count
+    *   A flat array of count (source, target) pairs, as AddEdges() takes them.
+    */
+    Graph(const std::pair<I, I>* edges, std::size_t count, std::pmr::memory_resource* resource = nullptr) noexcept;
     Graph(Graph&&) noexcept;
     ~Graph();
 
     void AddVertex(const std::vector<I>& list);
     void AddVertices(const std::vector<std::vector<I>>& lists);
-    void RemoveVertex(Vertex*);
-    void Breadth(Vertex*);
-    void Depth(Vertex*);
+    void AddEdge(const I& source, const I& target, double weight = 1);
+    void AddEdges(const std::pair<I, I>* edges, std::size_t count);    // In bulk: each list is looked up once, not once per edge.
+    void RemoveEdge(const I& source, const I& target);
+    void RemoveVertex(Vertex*); // O(V): renumbers the vertices after it, invalidating ids taken before (see Vertices).
+    void BreadthInPlace(Vertex*);
+    void BreadthInPlace(Vertex*, Dynamic);
+    void DepthInPlace(Vertex*);
+    BfsResult Breadth(Vertex*) const;
+    BfsResult Breadth(Vertex*, ThreadPool&) const;  // Same result, levels expanded in parallel.
+    MultiSourceBfsResult Breadth(const std::vector<Vertex*>& sources) const;   // Distances from the nearest source.
+    BatchBfsResult BatchBreadth(const std::vector<Vertex*>& sources) const;    // Distances from each source.
+    DfsResult Depth(Vertex*) const;
+    DijkstraResult Dijkstra(Vertex* s, Vertex* target = nullptr) const;    // Stops once target is settled.
     std::vector<Vertex*> ShortestPath(Vertex* s, Vertex* v);
-    void Transpose();
+    std::vector<Vertex*> ShortestPath(Vertex* s, Vertex* v, Bidirectional) const;
+    template <typename Heuristic>
+    std::vector<Vertex*> AlternateShortestPath(Vertex* s, Vertex* v, const Heuristic& h) const; // A*: h(u) estimates the weight from u to v.
+    Components StronglyConnectedComponents() const; // Indexed by Vertex::id.
+    void Transpose();   // O(1) once KeepInEdges() has been called.
+    void KeepInEdges() { vertices.KeepReverse(); }  // Keeps every vertex's in-edges from now on.
+    CsrGraph<I, Hash, Equal> Freeze();  // Read-only snapshot for repeated queries.
 
     void Summarize(std::ostream& os);
 
-    int InDegree(Vertex* v);
+    int InDegree(Vertex* v) const;  // O(1): Vertices counts incoming edges as they change.
+    Degrees DegreeDistribution() const { return vertices.DegreeDistribution(); }
+    double Weight(Vertex* u, Vertex* v) const { return vertices.Weight(u, v); }
     int OutDegree(Vertex* v) { return vertices[v].Size(); }
+    Vertex* Parent(Vertex* v) const { return vertices.Parent(v); } // Of v in the tree the last in-place search recorded.
     std::vector<Vertex*>& VertexSet() { return vertices.set; }
-    GraphList<I>& Edges(Vertex* v) { return vertices[v]; }
+    typename Vertices::List& Edges(Vertex* v) { return vertices[v]; }
+    const typename Vertices::List& InEdges(Vertex* v) const { return vertices.InEdges(v); }   // After KeepInEdges().
 
 private:
     Vertex* AcquireVertex(I&& list_head);
-    bool InGraph(Vertex*);
+    Vertex* Resolve(const I& item);
+    Vertex* InGraph(const Vertex*) const;   // This graph's vertex holding the item of the argument, if any.
     static void Reset(Graph& g, Vertex* s = nullptr);
-    static bool NotFound(const Vertex*);
+    void Publish(const BfsResult&);
+    void Publish(const DfsResult&);
+    void Relax(Vertex* u, Vertex* v);
+    std::vector<Vertex*> Subtree(Vertex* v) const;
+    void Repair(const std::vector<Vertex*>& affected);
+    void Propagate(std::vector<std::pair<int, Vertex*>>& seeds);
 
-    static void Breadth(Graph& g, Vertex* s);
-    static void Depth(Graph& g, Vertex* s);
-    static void Visit(Graph& g, Vertex* v);
+    static constexpr int unreached = 100000;
 
+    std::unique_ptr<Arena> arena;   // Declared before vertices, to outlive them.
     Vertices vertices;
-    int time;
+    Vertex* root = nullptr; // Source of the tree kept by BreadthInPlace(s, Dynamic{}), if any.
 };
 
-template <typename I>
-Graph<I>::Graph(const std::vector<std::vector<I>>& incidentals_list) noexcept
-    : vertices{ incidentals_list.size() }, time{}
+template <typename I, typename Hash, typename Equal>
+Graph<I, Hash, Equal>::Graph(const std::vector<std::vector<I>>& incidentals_list, std::pmr::memory_resource* resource) noexcept
+    : arena{ resource ? nullptr : std::make_unique<Arena>() },
+      vertices{ static_cast<int>(incidentals_list.size()), resource ? resource : arena->Resource() }
 {
     AddVertices(incidentals_list);
 }
 
-template <typename I>
-Graph<I>::Graph(Graph&& g) noexcept 
-    : vertices{ std::move(g.vertices) }, time{ g.time }
+template <typename I, typename Hash, typename Equal>
+Graph<I, Hash, Equal>::Graph(const std::pair<I, I>* edges, std::size_t count, std::pmr::memory_resource* resource) noexcept
+    : arena{ resource ? nullptr : std::make_unique<Arena>() },
+      vertices{ 0, resource ? resource : arena->Resource() }
+{
+    AddEdges(edges, count);
+}
+
+template <typename I, typename Hash, typename Equal>
+Graph<I, Hash, Equal>::Graph(Graph&& g) noexcept 
+    : arena{ std::move(g.arena) }, vertices{ std::move(g.vertices) }, root{ std::exchange(g.root, nullptr) }
 {
-    g.time = 0;
 }
 
-template <typename I>
-Graph<I>::~Graph()
+template <typename I, typename Hash, typename Equal>
+Graph<I, Hash, Equal>::~Graph()
 {
+    if (arena && std::is_trivially_destructible_v<I>) {
+        vertices.Abandon(); // Nothing to run per node: the arena releases them all at once.
+        return;
+    }
     for (Vertex* v : vertices.set) {
-        delete v;
-        v = nullptr;
+        Destroy(vertices.Resource(), v);
     }
 }
 
-template <typename I>
-void Graph<I>::AddVertex(const std::vector<I>& v_incidentals)
+template <typename I, typename Hash, typename Equal>
+void Graph<I, Hash, Equal>::AddVertex(const std::vector<I>& v_incidentals)
 {
     auto head = v_incidentals.begin();
     if (auto end = v_incidentals.end(); head != end) {
-        std::vector<I> incidentals { head + 1, end };
-        
-        if (Vertex* v = vertices.Search(*head)) {
-            vertices.AddRelations(v, incidentals);
-        }
-        else {
-            v = AcquireVertex(std::forward<I>(I{ *head }));
-            vertices.AddVertex(v, incidentals);
-        }
+        Vertex* v = Resolve(*head);
 
-        for (auto i : incidentals) {
-            AddVertex({ i });
+        std::vector<Vertex*> incidentals;
+        incidentals.reserve(end - head - 1);
+        for (auto i = head + 1; i != end; ++i) { // Edges are resolved to vertex handles once, here.
+            incidentals.push_back(Resolve(*i));
+        }
+        vertices.AddRelations(v, incidentals);
+        if (root) {
+            for (Vertex* u : incidentals) {
+                Relax(v, u);
+            }
         }
     }
 }
 
-template <typename I>
-void Graph<I>::AddVertices(const std::vector<std::vector<I>>& incidentals_list)
+template <typename I, typename Hash, typename Equal>
+void Graph<I, Hash, Equal>::AddVertices(const std::vector<std::vector<I>>& incidentals_list)
 {
     for (const std::vector<I>& incidentals : incidentals_list) {
         AddVertex(incidentals);
     }
 }
 
-template <typename I>
-void Graph<I>::RemoveVertex(Vertex* v)
+template <typename I, typename Hash, typename Equal>
+void Graph<I, Hash, Equal>::AddEdge(const I& source, const I& target, double weight)
+{
+    Vertex* u = Resolve(source);
+    Vertex* v = Resolve(target);
+    vertices.AddRelations(u, { v });
+    vertices.SetWeight(u, v, weight);
+    if (root) {
+        Relax(u, v);
+    }
+}
+
+template <typename I, typename Hash, typename Equal>
+void Graph<I, Hash, Equal>::AddEdges(const std::pair<I, I>* edges, std::size_t count)
 {
+    // One hashing pass numbers the items of both ends of every edge densely...
+    DenseIds<I, Hash, Equal> ids;
+    std::vector<std::uint32_t> ends(2 * count);
+    for (std::size_t e = 0; e < count; ++e) { // A run of edges from one source hashes it once.
+        ends[2 * e] = e && Equal{}(edges[e].first, edges[e - 1].first) ? ends[2 * e - 2] : ids(edges[e].first);
+        ends[2 * e + 1] = ids(edges[e].second);
+    }
+    const std::uint32_t n = ids.Size();
+    std::vector<Vertex*> handles(n);   // Each item is looked up in the graph once, in order of first appearance.
+    for (std::uint32_t k = 0; k < n; ++k) {
+        handles[k] = Resolve(ids.Item(k));
+    }
+
+    // ...and a counting sort groups the targets by source, in the order given.
+    std::vector<std::size_t> offsets(n + 1);
+    for (std::size_t e = 0; e < count; ++e) {
+        ++offsets[ends[2 * e] + 1];
+    }
+    for (std::uint32_t k = 0; k < n; ++k) {
+        offsets[k + 1] += offsets[k];
+    }
+    std::vector<Vertex*> targets(count);
+    std::vector<std::size_t> cursor{ offsets.begin(), offsets.end() - 1 };
+    for (std::size_t e = 0; e < count; ++e) {
+        targets[cursor[ends[2 * e]]++] = handles[ends[2 * e + 1]];
+    }
+    ends = {};
+
+    for (std::uint32_t k = 0; k < n; ++k) {
+        Vertex* const* first = targets.data() + offsets[k];
+        Vertex* const* last = targets.data() + offsets[k + 1];
+        vertices.AddRelations(handles[k], first, last);
+        if (root) {
+            for (; first != last; ++first) {
+                Relax(handles[k], *first);
+            }
+        }
+    }
+}
+
+template <typename I, typename Hash, typename Equal>
+void Graph<I, Hash, Equal>::RemoveEdge(const I& source, const I& target)
+{
+    Vertex* u = vertices.Search(source);
+    Vertex* v = vertices.Search(target);
+    if (u && v) {
+        vertices.RemoveRelation(u, v);
+        if (root && v->p == u->id && !vertices.Edges(u).Search(target)) {
+            Repair(Subtree(v));
+        }
+    }
+}
+
+template <typename I, typename Hash, typename Equal>
+void Graph<I, Hash, Equal>::RemoveVertex(Vertex* v)
+{
+    if (!v || InGraph(v) != v) {
+        return;
+    }
+    if (root && root != v) {
+        auto affected = Subtree(v);
+        affected.erase(std::remove(affected.begin(), affected.end(), v), affected.end());
+        vertices.RemoveVertex(v);
+        Repair(affected);
+        return;
+    }
+    root = nullptr; // Without its root, there is no tree left to keep.
     vertices.RemoveVertex(v);
     Graph::Reset(*this);
 }
 
-template <typename I>
-Vertex<I>* Graph<I>::AcquireVertex(I&& list_head)
+template <typename I, typename Hash, typename Equal>
+Vertex<I>* Graph<I, Hash, Equal>::AcquireVertex(I&& list_head)
 {
-    return Acquire<V, I>::Instance(std::forward<I>(list_head)).Release();
+    return Construct<Vertex>(vertices.Resource(), std::forward<I>(list_head));
 }
 
-template <typename I>
-bool Graph<I>::InGraph(Vertex* v)
+template <typename I, typename Hash, typename Equal>
+Vertex<I>* Graph<I, Hash, Equal>::Resolve(const I& item)
 {
-    if (auto u = vertices.Search(v->item)) {
-        return true;
+    Vertex* v = vertices.Search(item);
+    if (!v) {
+        v = AcquireVertex(I{ item });
+        vertices.AddVertex(v);
+        if (root) {
+            Vertex::Reset(v, false);
+        }
     }
-    return false;
+    return v;
+}
+
+template <typename I, typename Hash, typename Equal>
+Vertex<I>* Graph<I, Hash, Equal>::InGraph(const Vertex* v) const
+{
+    return v ? vertices.Search(v->item) : nullptr;
 }
 
-template <typename I>
-void Graph<I>::Reset(Graph& g, Vertex* source)
+template <typename I, typename Hash, typename Equal>
+void Graph<I, Hash, Equal>::Reset(Graph& g, Vertex* source)
 {
     for (Vertex* v : g.vertices) {
         Vertex::Reset(v, v == source);
     }
-    g.time = 0;
 }
 
-template <typename I>
-bool Graph<I>::NotFound(const Vertex* v) {
-    return v->s == Vertex::Status::nf;
+template <typename I, typename Hash, typename Equal>
+void Graph<I, Hash, Equal>::Publish(const BfsResult& r)
+{
+    for (Vertex* v : vertices) {
+        v->s = r.S(v);
+        v->dist = r.Dist(v);
+        v->t_found = 0;
+        v->t_disc = 0;
+        v->p = r.Parent(v) ? r.Parent(v)->id : Vertex::none;
+    }
 }
 
-template <typename I>
-void Graph<I>::Breadth(Vertex* v)
+template <typename I, typename Hash, typename Equal>
+void Graph<I, Hash, Equal>::Publish(const DfsResult& r)
 {
-    if(InGraph(v)) {
-        Graph::Breadth(*this, v);
+    for (Vertex* v : vertices) {
+        v->s = r.S(v);
+        v->dist = unreached;
+        v->t_found = r.TimeFound(v);
+        v->t_disc = r.TimeDiscovered(v);
+        v->p = r.Parent(v) ? r.Parent(v)->id : Vertex::none;
     }
 }
 
-template <typename I>
-void Graph<I>::Depth(Vertex* v)
+template <typename I, typename Hash, typename Equal>
+void Graph<I, Hash, Equal>::BreadthInPlace(Vertex* v)
 {
     if (InGraph(v)) {
-        Graph::Depth(*this, v);
+        root = nullptr;
+        Publish(Breadth(v));
     }
 }
 
-template <typename I>
-void Graph<I>::Transpose()
+template <typename I, typename Hash, typename Equal>
+void Graph<I, Hash, Equal>::BreadthInPlace(Vertex* v, Dynamic)
 {
-    vertices.Transpose();
+    if ((v = InGraph(v))) {
+        Publish(Breadth(v));
+        root = v;
+    }
 }
 
-template <typename I>
-void Graph<I>::Breadth(Graph& g, Vertex* source)
+/**
+* Relax
+*   After inserting u -> v: v, and whatever it leads to, may now lie closer to the root.
+*/
+template <typename I, typename Hash, typename Equal>
+void Graph<I, Hash, Equal>::Relax(Vertex* u, Vertex* v)
 {
-    Graph::Reset(g, source);
-    Queue<V, I> Q;
-    Q.Enqueue(source);
-    while (Vertex* u = Q.Dequeue()) {
-        for (auto v : g.vertices[u]) {
-            if (NotFound(v)) {
-                v->p = u;
-                v->dist = u->dist + 1;
-                v->s = Vertex::Status::f;
-                Q.Enqueue(v);
+    if (u->dist != unreached && u->dist + 1 < v->dist) {
+        v->dist = u->dist + 1;
+        v->p = u->id;
+        std::vector<std::pair<int, Vertex*>> seeds{ { v->dist, v } };
+        Propagate(seeds);
+    }
+}
+
+/**
+* Subtree
+*   The vertices whose path from the root, along p, passes through v: the only ones whose distance
+*   may grow once an edge into v, or v itself, goes.
+*/
+template <typename I, typename Hash, typename Equal>
+std::vector<Vertex<I>*> Graph<I, Hash, Equal>::Subtree(Vertex* v) const
+{
+    std::vector<Vertex*> tree;
+    Bitset member{ vertices.set.size() };   // Parallel edges lead to a child more than once.
+    if (v->dist != unreached) {
+        tree.push_back(v);
+        member.Set(v->id);
+    }
+    for (std::size_t i = 0; i < tree.size(); ++i) {
+        for (Vertex* w : vertices.Edges(tree[i])) {
+            if (w->p == tree[i]->id && !member.TestAndSet(w->id)) {
+                tree.push_back(w);
+            }
+        }
+    }
+    return tree;
+}
+
+/**
+* Repair
+*   Unlinks the affected vertices from the tree, reattaches each to its nearest unaffected in-neighbour,
+*   if any, and propagates the new distances through the affected region.
+*/
+template <typename I, typename Hash, typename Equal>
+void Graph<I, Hash, Equal>::Repair(const std::vector<Vertex*>& affected)
+{
+    if (affected.empty()) {
+        return;
+    }
+    for (Vertex* v : affected) {
+        Vertex::Reset(v, false);
+    }
+    auto attach = [](Vertex* u, Vertex* v) {
+        if (u->dist != unreached && u->dist + 1 < v->dist) {
+            v->dist = u->dist + 1;
+            v->p = u->id;
+            v->s = Vertex::Status::f;
+        }
+    };
+    if (vertices.Reversible()) {
+        for (Vertex* v : affected) {
+            for (Vertex* u : vertices.InEdges(v)) {
+                attach(u, v);
             }
         }
+    }
+    else {  // Find the edges entering the affected region, which alone lead from reached vertices to unreached ones.
+        for (Vertex* u : vertices.set) {
+            if (u->dist == unreached) {
+                continue;
+            }
+            for (Vertex* v : vertices.Edges(u)) {
+                if (v->dist == unreached || v->s == Vertex::Status::f) {
+                    attach(u, v);
+                }
+            }
+        }
+    }
+    std::vector<std::pair<int, Vertex*>> seeds;
+    for (Vertex* v : affected) {
+        if (v->s == Vertex::Status::f) {
+            seeds.emplace_back(v->dist, v);
+        }
+    }
+    std::sort(seeds.begin(), seeds.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    Propagate(seeds);
+}
+
+/**
+* Propagate
+*   Breadth-first from seeds, in order of distance, lowering the distance of every vertex reached by a shorter path.
+*   Seeds and the queue are merged by distance, so each vertex settles at its final distance when first taken.
+*/
+template <typename I, typename Hash, typename Equal>
+void Graph<I, Hash, Equal>::Propagate(std::vector<std::pair<int, Vertex*>>& seeds)
+{
+    std::vector<std::pair<int, Vertex*>> Q;
+    std::size_t next_seed = 0;
+    for (std::size_t head = 0; head < Q.size() || next_seed < seeds.size();) {
+        const bool from_seeds = head == Q.size() || (next_seed < seeds.size() && seeds[next_seed].first < Q[head].first);
+        auto [d, u] = from_seeds ? seeds[next_seed++] : Q[head++];
+        if (d != u->dist) {
+            continue;   // Superseded by a shorter path.
+        }
         u->s = Vertex::Status::d;
+        for (Vertex* v : vertices.Edges(u)) {
+            if (d + 1 < v->dist) {
+                v->dist = d + 1;
+                v->p = u->id;
+                v->s = Vertex::Status::f;
+                Q.emplace_back(d + 1, v);
+            }
+        }
     }
 }
 
-template <typename I>
-void Graph<I>::Depth(Graph& g, Vertex* source)
+template <typename I, typename Hash, typename Equal>
+void Graph<I, Hash, Equal>::DepthInPlace(Vertex* v)
 {
-    Graph::Reset(g);
-    bool source_found{};
-    auto stand_in = g.VertexSet();
-    stand_in.reserve(stand_in.size() * 2);
-    for (Vertex* v : stand_in) {
-        if (!source_found && v != source) {
-            stand_in.push_back(v);
+    if (InGraph(v)) {
+        root = nullptr;
+        Publish(Depth(v));
+    }
+}
+
+template <typename I, typename Hash, typename Equal>
+void Graph<I, Hash, Equal>::Transpose()
+{
+    vertices.Transpose();
+    if (root) {
+        BreadthInPlace(root, Dynamic{});
+    }
+}
+
+template <typename I, typename Hash, typename Equal>
+CsrGraph<I, Hash, Equal> Graph<I, Hash, Equal>::Freeze()
+{
+    return CsrGraph<I, Hash, Equal>{ vertices };
+}
+
+template <typename I, typename Hash, typename Equal>
+BfsResult<I, Vertex<I>*> Graph<I, Hash, Equal>::Breadth(Vertex* source) const
+{
+    BfsResult r{ vertices.set.size() };
+    if (!(source = InGraph(source))) {
+        return r;
+    }
+    std::vector<Vertex*> Q;  // Every vertex is enqueued at most once.
+    Q.reserve(vertices.set.size());
+    Q.push_back(source);
+    Bitset visited{ vertices.set.size() };
+    visited.Set(source->id);
+    r.s[source->id] = Vertex::Status::f;
+    r.dist[source->id] = 0;
+    for (std::size_t head = 0; head < Q.size(); ++head) {
+        Vertex* u = Q[head];
+        for (Vertex* v : vertices.Edges(u)) {
+            if (!visited.TestAndSet(v->id)) {
+                r.p[v->id] = u;
+                r.dist[v->id] = r.dist[u->id] + 1;
+                r.s[v->id] = Vertex::Status::f;
+                Q.push_back(v);
+            }
         }
-        else if (NotFound(v)) {
-            source_found = true;
-            Visit(g, v);
+        r.s[u->id] = Vertex::Status::d;
+    }
+    return r;
+}
+
+template <typename I, typename Hash, typename Equal>
+MultiSourceBfsResult<I, Vertex<I>*> Graph<I, Hash, Equal>::Breadth(const std::vector<Vertex*>& sources) const
+{
+    MultiSourceBfsResult r{ vertices.set.size() };
+    std::vector<Vertex*> seeds;
+    seeds.reserve(sources.size());
+    for (Vertex* s : sources) {
+        if ((s = InGraph(s))) {
+            seeds.push_back(s);
         }
     }
+    MultiSourceBreadth(r, seeds, [this](Vertex* u, auto&& visit) {
+        for (Vertex* v : vertices.Edges(u)) {
+            visit(v);
+        }
+    });
+    return r;
 }
 
-template <typename I>
-void Graph<I>::Visit(Graph& g, Vertex* v)
+template <typename I, typename Hash, typename Equal>
+BatchBfsResult<I, Vertex<I>*> Graph<I, Hash, Equal>::BatchBreadth(const std::vector<Vertex*>& sources) const
 {
-    v->t_found = ++g.time;
-    v->s = Vertex::Status::f;
-    for (Vertex* u : g.vertices[v]) {
-        if (NotFound(u)) {
-            u->p = v;
-            Visit(g, u);
+    std::vector<Vertex*> resolved(sources.size());
+    std::transform(sources.begin(), sources.end(), resolved.begin(), [this](Vertex* s) { return InGraph(s); });
+    BatchBfsResult r{ vertices.set.size(), std::move(resolved) };
+    ::BatchBreadth(r, [this](Vertex* u, auto&& visit) {
+        for (Vertex* v : vertices.Edges(u)) {
+            visit(v);
         }
+    }, [this](std::uint32_t i) { return vertices.set[i]; });
+    return r;
+}
+
+template <typename I, typename Hash, typename Equal>
+BfsResult<I, Vertex<I>*> Graph<I, Hash, Equal>::Breadth(Vertex* source, ThreadPool& pool) const
+{
+    BfsResult r{ vertices.set.size() };
+    if ((source = InGraph(source))) {
+        ParallelBreadth(r, source, [this](Vertex* u, auto&& visit) {
+            for (Vertex* v : vertices.Edges(u)) {
+                visit(v);
+            }
+        }, pool);
     }
-    v->t_disc = ++g.time;
-    v->s = Vertex::Status::d;
+    return r;
 }
 
-template <typename I>
-std::vector<Vertex<I>*> Graph<I>::ShortestPath(Vertex* s, Vertex* v)
+/**
+*   Visits the source first, then every vertex following it in the vertex set that remains undiscovered.
+*   Descends through an explicit stack, so the depth of the graph is bounded by memory rather than by the call stack.
+*/
+template <typename I, typename Hash, typename Equal>
+DfsResult<I, Vertex<I>*> Graph<I, Hash, Equal>::Depth(Vertex* source) const
+{
+    DfsResult r{ vertices.set.size() };
+    if (!(source = InGraph(source))) {
+        return r;
+    }
+    using Edge = typename Vertices::List::Iterator;
+    int time{};
+    Bitset visited{ vertices.set.size() };
+    std::vector<std::pair<Vertex*, Edge>> stack; // (Vertex, next edge to examine)
+    auto discover = [&](Vertex* v) {
+        r.t_found[v->id] = ++time;
+        r.s[v->id] = Vertex::Status::f;
+        stack.emplace_back(v, vertices.Edges(v).begin());
+    };
+    for (std::size_t root = source->id; root < vertices.set.size(); ++root) {
+        if (visited.TestAndSet(root)) {
+            continue;
+        }
+        discover(vertices.set[root]);
+        while (!stack.empty()) {
+            auto& [v, e] = stack.back();
+            if (e != vertices.Edges(v).end()) {
+                Vertex* u = *e;
+                ++e;
+                if (!visited.TestAndSet(u->id)) {
+                    r.p[u->id] = v;
+                    discover(u);
+                }
+            }
+            else {
+                r.t_disc[v->id] = ++time;
+                r.s[v->id] = Vertex::Status::d;
+                stack.pop_back();
+            }
+        }
+    }
+    return r;
+}
+
+template <typename I, typename Hash, typename Equal>
+DijkstraResult<I, Vertex<I>*> Graph<I, Hash, Equal>::Dijkstra(Vertex* source, Vertex* target) const
+{
+    DijkstraResult r{ vertices.set.size() };
+    if ((source = InGraph(source))) {
+        ::Dijkstra(r, source, InGraph(target), [this](Vertex* u, auto&& relax) {
+            for (Vertex* v : vertices.Edges(u)) {
+                relax(v, vertices.Weight(u, v));
+            }
+        }, [this](std::uint32_t i) { return vertices.set[i]; });
+    }
+    return r;
+}
+
+template <typename I, typename Hash, typename Equal>
+template <typename Heuristic>
+std::vector<Vertex<I>*> Graph<I, Hash, Equal>::AlternateShortestPath(Vertex* source, Vertex* v, const Heuristic& h) const
+{
+    if (!(source = InGraph(source)) || !(v = InGraph(v))) {
+        return {};
+    }
+    DijkstraResult r{ vertices.set.size() };
+    AStar(r, source, v, [this](Vertex* u, auto&& relax) {
+        for (Vertex* w : vertices.Edges(u)) {
+            relax(w, vertices.Weight(u, w));
+        }
+    }, [this](std::uint32_t i) { return vertices.set[i]; }, h);
+    return r.ShortestPath(source, v);
+}
+
+template <typename I, typename Hash, typename Equal>
+std::vector<Vertex<I>*> Graph<I, Hash, Equal>::ShortestPath(Vertex* s, Vertex* v)
 {
     std::vector<Vertex*> path;
     if (s && v) {
@@ -223,22 +641,54 @@ std::vector<Vertex<I>*> Graph<I>::ShortestPath(Vertex* s, Vertex* v)
     return path;
 }
 
-template <typename I>
-void Graph<I>::Summarize(std::ostream& os)
+template <typename I, typename Hash, typename Equal>
+std::vector<Vertex<I>*> Graph<I, Hash, Equal>::ShortestPath(Vertex* s, Vertex* v, Bidirectional) const
+{
+    if (!(s = InGraph(s)) || !(v = InGraph(v))) {
+        return {};
+    }
+    auto out = [this](Vertex* u, auto&& f) {
+        for (Vertex* w : vertices.Edges(u)) {
+            f(w);
+        }
+    };
+    if (vertices.Reversible()) {
+        return BidirectionalBreadth(vertices.set.size(), s, v, out, [this](Vertex* w, auto&& f) {
+            for (Vertex* u : vertices.InEdges(w)) {
+                f(u);
+            }
+        });
+    }
+    // Without KeepInEdges(), gather the in-edges the backward search walks.
+    std::vector<std::vector<Vertex*>> in(vertices.set.size());
+    for (Vertex* u : vertices.set) {
+        for (Vertex* w : vertices.Edges(u)) {
+            in[w->id].push_back(u);
+        }
+    }
+    return BidirectionalBreadth(vertices.set.size(), s, v, out, [&in](Vertex* w, auto&& f) {
+        for (Vertex* u : in[w->id]) {
+            f(u);
+        }
+    });
+}
+
+template <typename I, typename Hash, typename Equal>
+Components Graph<I, Hash, Equal>::StronglyConnectedComponents() const
+{
+    return StronglyConnected(static_cast<std::uint32_t>(vertices.set.size()),
+        [this](std::uint32_t v) -> const typename Vertices::List& { return vertices.Edges(vertices.set[v]); });
+}
+
+template <typename I, typename Hash, typename Equal>
+void Graph<I, Hash, Equal>::Summarize(std::ostream& os)
 {
     Summary<I>{ vertices.set, os }.Print();
 }
 
-template <typename I>
-int Graph<I>::InDegree(Vertex* v)
+template <typename I, typename Hash, typename Equal>
+int Graph<I, Hash, Equal>::InDegree(Vertex* v) const
 {
-    int degree{};
-    for (auto u : vertices.set) {
-        for (auto incidental : vertices[u]) {
-            if (incidental->item == v->item) {
-                ++degree;
-            }
-        }
-    }
-    return degree;
+    Vertex* u = InGraph(v);
+    return u ? vertices.InDegree(u) : 0;
 }
\ No newline at end of file
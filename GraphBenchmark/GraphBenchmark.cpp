@@ -0,0 +1,423 @@
+#include "GraphBenchmark.hpp"
+
+/**
+*   Breadth() on path and star graphs of doubling size; time per vertex should stay flat.
+*/
+void BreadthFrontier()
+{
+    for (int n = 1 << 17; n <= 1 << 20; n <<= 1) {
+        Graph<int> path{ PathInput(n) };
+        Report("Breadth/path", n, n - 1, Milliseconds([&] { path.BreadthInPlace(path.VertexSet()[0]); }));
+    }
+    for (int n = 1 << 17; n <= 1 << 20; n <<= 1) {
+        Graph<int> star{ StarInput(n) };
+        Report("Breadth/star", n + 1, n, Milliseconds([&] { star.BreadthInPlace(star.VertexSet()[0]); }));
+    }
+}
+
+/**
+*   Breadth() on an R-MAT graph from 1 up to hardware_concurrency threads, against the serial search.
+*/
+void ParallelBreadthScaling()
+{
+    Graph<int> g{ RmatInput(18, 16) };
+    const Graph<int>& cg = g;
+    auto csr = g.Freeze();
+    auto source = g.VertexSet()[0];
+    const size_t vertices = csr.Size();
+    const size_t edges = csr.EdgesEnd(csr.Size() - 1) - csr.EdgesBegin(0);
+
+    Report("ParallelBreadth/graph/serial", vertices, edges, Milliseconds([&] { cg.Breadth(source); }));
+    Report("ParallelBreadth/csr/serial", vertices, edges, Milliseconds([&] { csr.Breadth(0); }));
+    const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned threads = 1; threads <= hardware; threads *= 2) {
+        ThreadPool pool{ threads };
+        const std::string suffix = "/t=" + std::to_string(threads);
+        Report("ParallelBreadth/graph" + suffix, vertices, edges, Milliseconds([&] { cg.Breadth(source, pool); }));
+        Report("ParallelBreadth/csr" + suffix, vertices, edges, Milliseconds([&] { csr.Breadth(0, pool); }));
+    }
+}
+
+/**
+*   Direction-optimizing against plain top-down Breadth() on an R-MAT graph, over a few thresholds.
+*/
+void DirectionOptimizingBreadth()
+{
+    Graph<int> g{ RmatInput(18, 16) };
+    auto csr = g.Freeze();
+    const size_t vertices = csr.Size();
+    const size_t edges = csr.EdgesEnd(csr.Size() - 1) - csr.EdgesBegin(0);
+
+    Report("DirectionOptimizing/top-down", vertices, edges, Milliseconds([&] { csr.Breadth(0); }));
+    for (DirectionOptimizing params : { DirectionOptimizing{}, DirectionOptimizing{ 4, 24 }, DirectionOptimizing{ 30, 10 } }) {
+        const std::string name = "DirectionOptimizing/a=" + std::to_string(params.alpha) + ",b=" + std::to_string(params.beta);
+        Report(name, vertices, edges, Milliseconds([&] { csr.Breadth(0, params); }));
+    }
+}
+
+/**
+*   StronglyConnectedComponents() on one giant component (a cycle of 2^19 vertices with random chords)
+*   and 2^17 three-vertex cycles, each feeding into the giant one.
+*/
+void StronglyConnectedComponentsMixed()
+{
+    const int giant = 1 << 19;
+    const int small = 1 << 17;
+    std::vector<std::vector<int>> lists;
+    std::uint64_t state = 1;
+    for (int u = 0; u < giant; ++u) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        lists.push_back({ u, (u + 1) % giant, static_cast<int>((state >> 33) % giant) });
+    }
+    for (int k = 0; k < small; ++k) {
+        const int u = giant + 3 * k;
+        lists.push_back({ u, u + 1, k % giant });
+        lists.push_back({ u + 1, u + 2 });
+        lists.push_back({ u + 2, u });
+    }
+    Graph<int> g{ lists };
+    auto csr = g.Freeze();
+    const size_t vertices = csr.Size();
+    const size_t edges = csr.EdgesEnd(csr.Size() - 1) - csr.EdgesBegin(0);
+
+    Report("StronglyConnected/graph", vertices, edges, Milliseconds([&] { g.StronglyConnectedComponents(); }));
+    Report("StronglyConnected/csr", vertices, edges, Milliseconds([&] { csr.StronglyConnectedComponents(); }));
+}
+
+/**
+*   100 point-to-point queries on an R-MAT graph: ShortestPath() after a full Breadth() against the bidirectional search.
+*/
+void PointToPointShortestPath()
+{
+    Graph<int> g{ RmatInput(18, 16) };
+    auto csr = g.Freeze();
+    const size_t vertices = csr.Size();
+    const size_t edges = csr.EdgesEnd(csr.Size() - 1) - csr.EdgesBegin(0);
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> queries;
+    std::uint64_t state = 7;
+    for (int q = 0; q < 100; ++q) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        queries.emplace_back(static_cast<std::uint32_t>((state >> 20) % vertices), static_cast<std::uint32_t>((state >> 40) % vertices));
+    }
+
+    size_t hops = 0;
+    Report("PointToPoint/breadth", vertices, edges, Milliseconds([&] {
+        for (auto [s, v] : queries) {
+            hops += csr.ShortestPath(s, v).size();
+        }
+    }));
+    Report("PointToPoint/bidirectional", vertices, edges, Milliseconds([&] {
+        for (auto [s, v] : queries) {
+            hops -= csr.ShortestPath(s, v, Bidirectional{}).size();
+        }
+    }));
+    if (hops) {
+        std::cout << "PointToPoint: path lengths differ\n";
+    }
+}
+
+/**
+*   Corner-to-corner and random point-to-point queries on a 1024 x 1024 grid:
+*   Dijkstra stopping at the target against A* guided by the Manhattan distance.
+*/
+void AlternateShortestPathGrid()
+{
+    const int width = 1024;
+    Graph<int> g{ GridInput(width) };
+    auto csr = g.Freeze();
+    const size_t vertices = csr.Size();
+    const size_t edges = csr.EdgesEnd(csr.Size() - 1) - csr.EdgesBegin(0);
+    std::vector<std::pair<int, int>> queries{ { 0, width * width - 1 } };
+    std::uint64_t state = 11;
+    for (int q = 0; q < 20; ++q) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        queries.emplace_back(static_cast<int>((state >> 20) % vertices), static_cast<int>((state >> 40) % vertices));
+    }
+
+    double length = 0;
+    Report("AlternateShortestPath/dijkstra", vertices, edges, Milliseconds([&] {
+        for (auto [s, t] : queries) {
+            length += csr.Dijkstra(csr.Search(s), csr.Search(t)).Dist(csr.Search(t));
+        }
+    }));
+    Report("AlternateShortestPath/a*", vertices, edges, Milliseconds([&] {
+        for (auto [s, t] : queries) {
+            auto manhattan = [&csr, t = t](std::uint32_t v) {
+                const int item = csr.Item(v);
+                return static_cast<double>(std::abs(item % width - t % width) + std::abs(item / width - t / width));
+            };
+            length -= csr.AlternateShortestPath(csr.Search(s), csr.Search(t), manhattan).size() - 1.0;
+        }
+    }));
+    if (length) {
+        std::cout << "AlternateShortestPath: path lengths differ\n";
+    }
+}
+
+/**
+*   Breadth-first searches from 256 sources of an R-MAT graph: one Breadth() each against BatchBreadth().
+*/
+void BatchBreadthSources()
+{
+    Graph<int> g{ RmatInput(16, 16) };
+    auto csr = g.Freeze();
+    const size_t vertices = csr.Size();
+    const size_t edges = csr.EdgesEnd(csr.Size() - 1) - csr.EdgesBegin(0);
+    std::vector<std::uint32_t> sources;
+    for (std::uint32_t k = 0; k < 256; ++k) {
+        sources.push_back(k * 2654435761u % csr.Size());
+    }
+
+    Report("BatchBreadth/one-by-one", vertices, edges, Milliseconds([&] {
+        for (std::uint32_t s : sources) {
+            csr.Breadth(s);
+        }
+    }));
+    Report("BatchBreadth/batched", vertices, edges, Milliseconds([&] { csr.BatchBreadth(sources); }));
+}
+
+/**
+*   200 random edge insertions and deletions on an R-MAT graph: BreadthInPlace(s, Dynamic{}) repairing its tree
+*   after each, against a fresh BreadthInPlace(s) after each.
+*/
+void DynamicBreadthUpdates()
+{
+    const int scale = 16;
+    std::vector<std::pair<int, int>> updates;
+    std::uint64_t state = 5;
+    for (int k = 0; k < 200; ++k) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        updates.emplace_back(static_cast<int>((state >> 20) % (1 << scale)), static_cast<int>((state >> 40) % (1 << scale)));
+    }
+    auto apply = [&](Graph<int>& g, auto&& after) {
+        for (std::size_t k = 0; k < updates.size(); ++k) {
+            auto [u, v] = updates[k];
+            if (k % 2) {    // Delete an edge of the tree where there is one: the costly case to repair.
+                Vertex<int>* w = g.VertexSet()[v];
+                if (Vertex<int>* p = g.Parent(w)) {
+                    g.RemoveEdge(p->item, w->item);
+                }
+            }
+            else {
+                g.AddEdge(u, v);
+            }
+            after(g);
+        }
+    };
+
+    Graph<int> recomputed{ RmatInput(scale, 16) };
+    const size_t vertices = recomputed.VertexSet().size();
+    const size_t edges = static_cast<size_t>(16) << scale;
+    recomputed.BreadthInPlace(recomputed.VertexSet()[0]);
+    Report("DynamicBreadth/recompute", vertices, edges, Milliseconds([&] {
+        apply(recomputed, [](Graph<int>& g) { g.BreadthInPlace(g.VertexSet()[0]); });
+    }));
+    Graph<int> dynamic{ RmatInput(scale, 16) };
+    dynamic.BreadthInPlace(dynamic.VertexSet()[0], Dynamic{});
+    Report("DynamicBreadth/repair", vertices, edges, Milliseconds([&] { apply(dynamic, [](Graph<int>&) {}); }));
+    Graph<int> reversible{ RmatInput(scale, 16) };
+    reversible.KeepInEdges();
+    reversible.BreadthInPlace(reversible.VertexSet()[0], Dynamic{});
+    Report("DynamicBreadth/repair+in-edges", vertices, edges, Milliseconds([&] { apply(reversible, [](Graph<int>&) {}); }));
+}
+
+/**
+*   Transpose() of an R-MAT graph, rebuilding the adjacency against exchanging it with the kept in-edges.
+*/
+void TransposeInEdges()
+{
+    Graph<int> g{ RmatInput(18, 16) };
+    const size_t vertices = g.VertexSet().size();
+    const size_t edges = static_cast<size_t>(16) << 18;
+
+    Report("Transpose/rebuild", vertices, edges, Milliseconds([&] { g.Transpose(); }));
+    Report("Transpose/keep-in-edges", vertices, edges, Milliseconds([&] { g.KeepInEdges(); }));
+    Report("Transpose/exchange", vertices, edges, Milliseconds([&] { g.Transpose(); }));
+}
+
+/**
+*   Building and destroying an R-MAT graph with its nodes in the default Arena against new/delete.
+*/
+void ArenaBuildDestroy()
+{
+    auto lists = RmatInput(18, 16);
+    const size_t vertices = lists.size();
+    const size_t edges = static_cast<size_t>(16) << 18;
+    for (std::pmr::memory_resource* resource : { std::pmr::new_delete_resource(), static_cast<std::pmr::memory_resource*>(nullptr) }) {
+        const std::string name = resource ? "Arena/new-delete" : "Arena/arena";
+        std::unique_ptr<Graph<int>> g;
+        Report(name + "/build", vertices, edges, Milliseconds([&] { g = std::make_unique<Graph<int>>(lists, resource); }));
+        Report(name + "/destroy", vertices, edges, Milliseconds([&] { g.reset(); }));
+    }
+}
+
+/**
+*   Bytes held per vertex and per edge by a Graph of an R-MAT graph with some ten million edges, counted at its
+*   memory resource: vertices, edge nodes, and the adjacency and index maps.
+*/
+void MemoryFootprint()
+{
+    Counting counting;
+
+    auto lists = RmatInput(20, 10);
+    Graph<int> g{ lists, &counting };
+    const size_t vertices = g.VertexSet().size();
+    const size_t edges = static_cast<size_t>(10) << 20;
+    using EdgeNode = Graph<int>::Vertices::List::Node;
+    std::cout << std::fixed << std::setprecision(1)
+              << "MemoryFootprint: |V| = " << vertices << ", |E| = " << edges << ", " << counting.bytes / 1e6 << " MB\n"
+              << "  sizeof(Vertex<int>) = " << sizeof(Vertex<int>) << " B, sizeof(edge node) = " << sizeof(EdgeNode) << " B\n"
+              << "  " << counting.bytes / double(vertices) << " B/vertex, " << counting.bytes / double(edges) << " B/edge overall\n";
+}
+
+/**
+*   Loading an R-MAT edge list of some sixteen million edges: through adjacency lists, through Graph's bulk
+*   constructor from (source, target) pairs, and straight into a CsrGraph with CsrGraph::FromEdges().
+*/
+void BulkBuild()
+{
+    auto lists = RmatInput(20, 16);
+    std::vector<std::pair<int, int>> pairs;
+    for (const auto& list : lists) {
+        for (auto i = list.begin() + 1; i != list.end(); ++i) {
+            pairs.emplace_back(list.front(), *i);
+        }
+    }
+    const size_t vertices = lists.size();
+    const size_t edges = pairs.size();
+
+    std::unique_ptr<Graph<int>> g;
+    Report("BulkBuild/graph/lists", vertices, edges, Milliseconds([&] { g = std::make_unique<Graph<int>>(lists); }));
+    g.reset();
+    Report("BulkBuild/graph/pairs", vertices, edges, Milliseconds([&] { g = std::make_unique<Graph<int>>(pairs.data(), pairs.size()); }));
+    g.reset();
+    Report("BulkBuild/csr/pairs", vertices, edges, Milliseconds([&] { CsrGraph<int>::FromEdges(pairs.data(), pairs.size()); }));
+}
+
+/**
+*   Startup from a CsrFile against rebuilding: Open() of an R-MAT graph of some sixteen million edges, then the first
+*   Breadth() on the mapped pages, against Freeze() of the Graph. Open() should take the same time whatever the size.
+*/
+void CsrFileStartup()
+{
+    Graph<int> g{ RmatInput(20, 16) };
+    const std::string path = (std::filesystem::temp_directory_path() / "GraphBenchmark.csr").string();
+    const size_t vertices = g.VertexSet().size();
+    const size_t edges = static_cast<size_t>(16) << 20;
+    std::optional<CsrGraph<int>> csr;
+    Report("CsrFile/freeze", vertices, edges, Milliseconds([&] { csr = g.Freeze(); }));
+    Report("CsrFile/save", vertices, edges, Milliseconds([&] { csr->Save(path); }));
+    csr.reset();
+    Report("CsrFile/open", vertices, edges, Milliseconds([&] { csr = CsrGraph<int>::Open(path); }));
+    Report("CsrFile/first-breadth", vertices, edges, Milliseconds([&] { csr->Breadth(0); }));
+    Report("CsrFile/second-breadth", vertices, edges, Milliseconds([&] { csr->Breadth(0); }));
+    csr.reset();
+    std::filesystem::remove(path);
+}
+
+/**
+*   ReadEdgeList() of an R-MAT edge list of some eight million lines: parsing alone, from 1 up to hardware_concurrency
+*   threads, then parsing into a Graph through AddEdges(), against building the same Graph from adjacency lists.
+*/
+void EdgeListIngest()
+{
+    auto lists = RmatInput(19, 16);
+    const std::string path = (std::filesystem::temp_directory_path() / "GraphBenchmark.edges").string();
+    size_t edges = 0;
+    {
+        std::ofstream out{ path, std::ios::binary };
+        for (const auto& list : lists) {
+            for (auto i = list.begin() + 1; i != list.end(); ++i, ++edges) {
+                out << list.front() << ' ' << *i << '\n';
+            }
+        }
+    }
+    const size_t vertices = lists.size();
+
+    const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned threads = 1; threads <= hardware; threads *= 2) {
+        ThreadPool pool{ threads };
+        Report("EdgeList/parse/t=" + std::to_string(threads), vertices, edges, Milliseconds([&] {
+            ReadEdgeList<int>(path, pool, [](const std::pair<int, int>*, std::size_t) {});
+        }));
+    }
+    ThreadPool pool{ hardware };
+    Report("EdgeList/graph/lists", vertices, edges, Milliseconds([&] { Graph<int> g{ lists }; }));
+    Report("EdgeList/graph/file", vertices, edges, Milliseconds([&] {
+        Graph<int> g{ {} };
+        ReadEdgeList<int>(path, pool, [&g](const std::pair<int, int>* e, std::size_t count) { g.AddEdges(e, count); });
+    }));
+    std::filesystem::remove(path);
+}
+
+/**
+*   A graph of some four million edges between names of 20 characters, keyed by std::string, by const char* and by
+*   Interner ids: time to build and search it, and bytes held per vertex -- at the graph's memory resource, plus the
+*   interned copies for Interner::Id and the heap buffers of the strings in vertices and index for std::string.
+*/
+void InternedNames()
+{
+    auto lists = RmatInput(18, 16);
+    std::vector<std::string> names(lists.size());
+    for (size_t v = 0; v < names.size(); ++v) {
+        names[v] = "vertex-name-" + std::to_string(10000000 + v);
+    }
+    auto keyed = [&](auto key) {
+        std::vector<std::vector<decltype(key(0))>> out;
+        for (const auto& list : lists) {
+            auto& row = out.emplace_back();
+            for (int v : list) {
+                row.push_back(key(v));
+            }
+        }
+        return out;
+    };
+    const size_t vertices = lists.size();
+    const size_t edges = static_cast<size_t>(16) << 18;
+    auto report = [&](const std::string& name, auto&& input, size_t extra) {
+        using G = Graph<typename std::decay_t<decltype(input)>::value_type::value_type>;
+        Counting counting;
+        std::unique_ptr<G> g;
+        Report("InternedNames/" + name + "/build", vertices, edges, Milliseconds([&] { g = std::make_unique<G>(input, &counting); }));
+        const G& cg = *g;
+        Report("InternedNames/" + name + "/breadth", vertices, edges, Milliseconds([&] { cg.Breadth(g->VertexSet()[0]); }));
+        std::cout << std::fixed << std::setprecision(1) << "  " << (counting.bytes + extra) / double(vertices) << " B/vertex\n";
+    };
+
+    size_t buffers = 0;
+    for (const std::string& name : names) {
+        buffers += 2 * (name.capacity() + 1);   // Heap buffer of the item in the vertex and in the index.
+    }
+    report("string", keyed([&](int v) { return names[v]; }), buffers);
+    report("c-string", keyed([&](int v) { return names[v].c_str(); }), 0);
+    Counting strings;
+    Interner interner{ &strings };
+    auto interned = keyed([&](int v) { return interner.Intern(names[v]); });
+    report("interned", interned, strings.bytes);
+}
+
+int main(int argc, char** argv)
+{
+    const std::string filter{ argc > 1 ? argv[1] : "" };
+    auto run = [&](const std::string& name, void (*benchmark)()) {
+        if (name.find(filter) != std::string::npos) {
+            benchmark();
+        }
+    };
+
+    run("BreadthFrontier", BreadthFrontier);
+    run("ParallelBreadthScaling", ParallelBreadthScaling);
+    run("DirectionOptimizingBreadth", DirectionOptimizingBreadth);
+    run("StronglyConnectedComponentsMixed", StronglyConnectedComponentsMixed);
+    run("PointToPointShortestPath", PointToPointShortestPath);
+    run("AlternateShortestPathGrid", AlternateShortestPathGrid);
+    run("BatchBreadthSources", BatchBreadthSources);
+    run("DynamicBreadthUpdates", DynamicBreadthUpdates);
+    run("TransposeInEdges", TransposeInEdges);
+    run("ArenaBuildDestroy", ArenaBuildDestroy);
+    run("MemoryFootprint", MemoryFootprint);
+    run("BulkBuild", BulkBuild);
+    run("CsrFileStartup", CsrFileStartup);
+    run("EdgeListIngest", EdgeListIngest);
+    run("InternedNames", InternedNames);
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include "../Graph.hpp"
+#include "../Counting.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+* Benchmark helpers
+*   Each benchmark prints one row per input: name, |V|, |E|, milliseconds and nanoseconds per vertex.
+*   Build in Release; a benchmark runs only if its name contains the first command-line argument.
+*/
+template <typename F>
+double Milliseconds(F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+inline void Report(const std::string& name, size_t vertices, size_t edges, double ms)
+{
+    std::cout << std::setw(32) << std::left << name
+              << std::setw(12) << std::right << vertices
+              << std::setw(12) << std::right << edges
+              << std::setw(12) << std::right << std::fixed << std::setprecision(2) << ms << " ms"
+              << std::setw(10) << std::right << std::setprecision(1) << ms * 1e6 / vertices << " ns/v\n";
+}
+
+/**
+*   0 -> 1 -> ... -> n - 1
+*/
+inline std::vector<std::vector<int>> PathInput(int n)
+{
+    std::vector<std::vector<int>> lists(n);
+    for (int i = 0; i < n; ++i) {
+        lists[i] = i + 1 < n ? std::vector<int>{ i, i + 1 } : std::vector<int>{ i };
+    }
+    return lists;
+}
+
+/**
+*   0 -> { 1, ..., leaves }
+*/
+inline std::vector<std::vector<int>> StarInput(int leaves)
+{
+    std::vector<int> list(leaves + 1);
+    for (int i = 0; i <= leaves; ++i) {
+        list[i] = i;
+    }
+    return { list };
+}
+
+/**
+*   A width x width grid, vertex y * width + x joined both ways to its four neighbours.
+*/
+inline std::vector<std::vector<int>> GridInput(int width)
+{
+    std::vector<std::vector<int>> lists(width * width);
+    for (int y = 0; y < width; ++y) {
+        for (int x = 0; x < width; ++x) {
+            const int u = y * width + x;
+            lists[u].push_back(u);
+            for (int v : { x > 0 ? u - 1 : -1, x + 1 < width ? u + 1 : -1, y > 0 ? u - width : -1, y + 1 < width ? u + width : -1 }) {
+                if (v >= 0) {
+                    lists[u].push_back(v);
+                }
+            }
+        }
+    }
+    return lists;
+}
+
+/**
+*   An R-MAT graph on 2^scale vertices with edge_factor * 2^scale edges (a = .57, b = c = .19),
+*   whose degrees follow a power law. Deterministic for a given seed.
+*/
+inline std::vector<std::vector<int>> RmatInput(int scale, int edge_factor, std::uint64_t seed = 1)
+{
+    const int n = 1 << scale;
+    std::vector<std::vector<int>> lists(n);
+    for (int u = 0; u < n; ++u) {
+        lists[u].push_back(u);
+    }
+    auto next = [&seed] { // xorshift64*
+        seed ^= seed >> 12;
+        seed ^= seed << 25;
+        seed ^= seed >> 27;
+        return static_cast<double>((seed * 2685821657736338717ull) >> 11) / static_cast<double>(1ull << 53);
+    };
+    for (std::int64_t e = 0; e < static_cast<std::int64_t>(edge_factor) * n; ++e) {
+        int u = 0;
+        int v = 0;
+        for (int bit = scale - 1; bit >= 0; --bit) {
+            double r = next();
+            if (r >= .57 + .19 + .19) {
+                u |= 1 << bit;
+                v |= 1 << bit;
+            }
+            else if (r >= .57 + .19) {
+                u |= 1 << bit;
+            }
+            else if (r >= .57) {
+                v |= 1 << bit;
+            }
+        }
+        lists[u].push_back(v);
+    }
+    return lists;
+}
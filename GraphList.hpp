@@ -1,90 +1,85 @@
+#pragma once
 #include "Vertices.hpp"
 #include "List.hpp"
 
-template <typename I>
-class GraphList : public List<V, I> {
+/**
+* GraphList
+*   An adjacency list holding handles to the vertices of a graph.
+*   Handles are resolved once, on insertion, so iteration neither copies nor searches.
+*/
+template <typename I, typename Equal>
+class GraphList : public List<BiDirectionalNode, V<I>*> {
 public:
     using Vertex = V<I>;
-    using List<V, I>::List;
-    using list_iterator = typename List<V, I>::Iterator;
+    using List<BiDirectionalNode, Vertex*>::List;
+    using list_iterator = typename List<BiDirectionalNode, Vertex*>::Iterator;
 
-    struct set_uninitialized
-    {};
     struct Iterator : list_iterator {
-        explicit Iterator(Vertex* v, GraphList* g);
+        explicit Iterator(list_iterator it);
         Vertex* operator*(); // Deliberate departure from convention.
-        GraphList* g;
     };
 
     Iterator begin();
     Iterator end();
-    
-    Vertex* Search(const I& i);
-    void Normalize(Vertex**, GraphList* g);
-    void RemoveRelation(Vertex* relation);
+    Iterator begin() const;
+    Iterator end() const;
 
-    std::vector<Vertex*>* set{};
+    Vertex* Search(const I& i) const;
+    bool RemoveRelation(Vertex* relation);  // Whether the relation was held.
 };
 
-template <typename I>
-GraphList<I>::Iterator::Iterator(Vertex* v, GraphList* g)
-    : list_iterator{ v }, g{ g }
+template <typename I, typename Equal>
+GraphList<I, Equal>::Iterator::Iterator(list_iterator it)
+    : list_iterator{ it }
 {}
 
-template <typename I>
-V<I>* GraphList<I>::Iterator::operator*()
+template <typename I, typename Equal>
+V<I>* GraphList<I, Equal>::Iterator::operator*()
 {
-    Vertex v = List<V, I>::Iterator::operator*();
-    Vertex* w = &v;
-    g->Normalize(&w, g);
-    return w;
+    return list_iterator::operator&()->item;
 }
 
-template <typename I>
-typename GraphList<I>::Iterator GraphList<I>::begin()
+template <typename I, typename Equal>
+typename GraphList<I, Equal>::Iterator GraphList<I, Equal>::begin()
 {
-    Vertex* v = &List<V, I>::begin();
-    return Iterator{ v, this };
+    return Iterator{ List<BiDirectionalNode, Vertex*>::begin() };
 }
 
-template <typename I>
-typename GraphList<I>::Iterator GraphList<I>::end()
+template <typename I, typename Equal>
+typename GraphList<I, Equal>::Iterator GraphList<I, Equal>::end()
 {
-    Vertex* v = &List<V, I>::end();
-    return Iterator{ v, this };
+    return Iterator{ List<BiDirectionalNode, Vertex*>::end() };
 }
 
-template <typename I>
-V<I>* GraphList<I>::Search(const I& i)
+template <typename I, typename Equal>
+typename GraphList<I, Equal>::Iterator GraphList<I, Equal>::begin() const
 {
-    Vertex* index = List<V, I>::Search(i);
-    if (index) {
-        Normalize(&index, this);
-    }
-    return index;
+    return Iterator{ List<BiDirectionalNode, Vertex*>::begin() };
+}
+
+template <typename I, typename Equal>
+typename GraphList<I, Equal>::Iterator GraphList<I, Equal>::end() const
+{
+    return Iterator{ List<BiDirectionalNode, Vertex*>::end() };
 }
 
-template <typename I>
-void GraphList<I>::Normalize(Vertex** list_v, GraphList* g)
+template <typename I, typename Equal>
+V<I>* GraphList<I, Equal>::Search(const I& i) const
 {
-    if (set) {
-        for (auto v : *g->set) {
-            if (v->item == (*list_v)->item) {
-                *list_v = v;
-                return;
-            }
+    for (Vertex* v : *this) {
+        if (Equal{}(v->item, i)) {
+            return v;
         }
     }
-    else {
-        throw set_uninitialized{};
-    }
+    return nullptr;
 }
 
-
-template <typename I>
-void GraphList<I>::RemoveRelation(Vertex* relation)
+template <typename I, typename Equal>
+bool GraphList<I, Equal>::RemoveRelation(Vertex* relation)
 {
-    if (auto v = List<V, I>::Search(std::move(relation->item))) {
-        List<V, I>::Delete(&v);
+    if (auto n = List<BiDirectionalNode, Vertex*>::Search(relation)) {
+        List<BiDirectionalNode, Vertex*>::Delete(&n);
+        return true;
     }
-}
\ No newline at end of file
+    return false;
+}
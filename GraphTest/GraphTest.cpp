@@ -1,5 +1,7 @@
 #include "GraphTest.hpp"
 #include <string>
+#include <filesystem>
+#include <fstream>
 
 TEST_F(GraphTest, SetSize)
 {
@@ -17,6 +19,16 @@ TEST_F(GraphTest, SetOrder)
     ASSERT_EQ(v[2]->item, v_comp[2]);
 }
 
+TEST_F(GraphTest, IndexComparesContent)
+{
+    Graph<const char*>& g = this->directed;
+    std::string c { "c" };  // Same content as the literal "c", distinct address.
+
+    g.AddVertex({ c.c_str() });
+    ASSERT_EQ(g.VertexSet().size(), 3);
+    ASSERT_EQ(g.OutDegree(g.VertexSet()[2]), 0);
+}
+
 TEST_F(GraphTest, MatchingEdgesUndirected)
 {
     Graph<const char*>& g = this->undirected;
@@ -131,38 +143,38 @@ TEST_F(GraphTest, BreadthUndirected)
     
     auto discovered = Vertex<const char*>::Status::d;
     
-    g.Breadth(a);
+    g.BreadthInPlace(a);
     ASSERT_EQ(a->s, discovered);
     ASSERT_EQ(b->s, discovered);
     ASSERT_EQ(c->s, discovered);
     ASSERT_EQ(a->dist, 0);
     ASSERT_EQ(b->dist, 1);
     ASSERT_EQ(c->dist, 2);
-    ASSERT_THAT(a->p, IsNull());
-    ASSERT_THAT(b->p, Eq(a));
-    ASSERT_THAT(c->p, Eq(b));
+    ASSERT_THAT(g.Parent(a), IsNull());
+    ASSERT_THAT(g.Parent(b), Eq(a));
+    ASSERT_THAT(g.Parent(c), Eq(b));
         
-    g.Breadth(b);
+    g.BreadthInPlace(b);
     ASSERT_EQ(a->s, discovered);
     ASSERT_EQ(b->s, discovered);
     ASSERT_EQ(c->s, discovered);
     ASSERT_EQ(a->dist, 1);
     ASSERT_EQ(b->dist, 0);
     ASSERT_EQ(c->dist, 1);
-    ASSERT_THAT(a->p, Eq(b));
-    ASSERT_THAT(b->p, IsNull());
-    ASSERT_THAT(c->p, Eq(b));
+    ASSERT_THAT(g.Parent(a), Eq(b));
+    ASSERT_THAT(g.Parent(b), IsNull());
+    ASSERT_THAT(g.Parent(c), Eq(b));
         
-    g.Breadth(c);
+    g.BreadthInPlace(c);
     ASSERT_EQ(a->s, discovered);
     ASSERT_EQ(b->s, discovered);
     ASSERT_EQ(c->s, discovered);
     ASSERT_EQ(a->dist, 2);
     ASSERT_EQ(b->dist, 1);
     ASSERT_EQ(c->dist, 0);
-    ASSERT_THAT(a->p, Eq(b));
-    ASSERT_THAT(b->p, Eq(c));
-    ASSERT_THAT(c->p, IsNull());
+    ASSERT_THAT(g.Parent(a), Eq(b));
+    ASSERT_THAT(g.Parent(b), Eq(c));
+    ASSERT_THAT(g.Parent(c), IsNull());
 }
 
 TEST_F(GraphTest, BreadthDirected)
@@ -176,38 +188,38 @@ TEST_F(GraphTest, BreadthDirected)
     auto discovered = Vertex<const char*>::Status::d;
     auto not_found = Vertex<const char*>::Status::nf;
     
-    g.Breadth(a);
+    g.BreadthInPlace(a);
     ASSERT_EQ(a->s, discovered);
     ASSERT_EQ(b->s, discovered);
     ASSERT_EQ(c->s, discovered);
     ASSERT_EQ(a->dist, 0);
     ASSERT_EQ(b->dist, 1);
     ASSERT_EQ(c->dist, 2);
-    ASSERT_THAT(a->p, IsNull());
-    ASSERT_THAT(b->p, Eq(a));
-    ASSERT_THAT(c->p, Eq(b));
+    ASSERT_THAT(g.Parent(a), IsNull());
+    ASSERT_THAT(g.Parent(b), Eq(a));
+    ASSERT_THAT(g.Parent(c), Eq(b));
     
-    g.Breadth(b);
+    g.BreadthInPlace(b);
     ASSERT_EQ(a->s, not_found);
     ASSERT_EQ(b->s, discovered);
     ASSERT_EQ(c->s, discovered);
     ASSERT_EQ(a->dist, 100000);
     ASSERT_EQ(b->dist, 0);
     ASSERT_EQ(c->dist, 1);
-    ASSERT_THAT(a->p, IsNull());
-    ASSERT_THAT(b->p, IsNull());
-    ASSERT_THAT(c->p, Eq(b));
+    ASSERT_THAT(g.Parent(a), IsNull());
+    ASSERT_THAT(g.Parent(b), IsNull());
+    ASSERT_THAT(g.Parent(c), Eq(b));
 
-    g.Breadth(c);
+    g.BreadthInPlace(c);
     ASSERT_EQ(a->s, not_found);
     ASSERT_EQ(b->s, not_found);
     ASSERT_EQ(c->s, discovered);
     ASSERT_EQ(a->dist, 100000);
     ASSERT_EQ(b->dist, 100000);
     ASSERT_EQ(c->dist, 0);
-    ASSERT_THAT(a->p, IsNull());
-    ASSERT_THAT(b->p, IsNull());
-    ASSERT_THAT(c->p, IsNull());
+    ASSERT_THAT(g.Parent(a), IsNull());
+    ASSERT_THAT(g.Parent(b), IsNull());
+    ASSERT_THAT(g.Parent(c), IsNull());
 }
 
 TEST_F(GraphTest, DepthUndirected)
@@ -221,7 +233,7 @@ TEST_F(GraphTest, DepthUndirected)
     auto discovered = Vertex<const char*>::Status::d;
     auto not_found = Vertex<const char*>::Status::nf;
     
-    g.Depth(a);
+    g.DepthInPlace(a);
     ASSERT_EQ(a->s, discovered);
     ASSERT_EQ(b->s, discovered);
     ASSERT_EQ(c->s, discovered);
@@ -231,11 +243,11 @@ TEST_F(GraphTest, DepthUndirected)
     ASSERT_EQ(a->t_disc, 6);
     ASSERT_EQ(b->t_disc, 5);
     ASSERT_EQ(c->t_disc, 4);
-    ASSERT_THAT(a->p, IsNull());
-    ASSERT_THAT(b->p, Eq(a));
-    ASSERT_THAT(c->p, Eq(b));
+    ASSERT_THAT(g.Parent(a), IsNull());
+    ASSERT_THAT(g.Parent(b), Eq(a));
+    ASSERT_THAT(g.Parent(c), Eq(b));
         
-    g.Depth(b);
+    g.DepthInPlace(b);
     ASSERT_EQ(a->s, discovered);
     ASSERT_EQ(b->s, discovered);
     ASSERT_EQ(c->s, discovered);
@@ -245,11 +257,11 @@ TEST_F(GraphTest, DepthUndirected)
     ASSERT_EQ(a->t_disc, 5);
     ASSERT_EQ(b->t_disc, 6);
     ASSERT_EQ(c->t_disc, 3);
-    ASSERT_THAT(a->p, Eq(b));
-    ASSERT_THAT(b->p, IsNull());
-    ASSERT_THAT(c->p, Eq(b));
+    ASSERT_THAT(g.Parent(a), Eq(b));
+    ASSERT_THAT(g.Parent(b), IsNull());
+    ASSERT_THAT(g.Parent(c), Eq(b));
         
-    g.Depth(c);
+    g.DepthInPlace(c);
     ASSERT_EQ(a->s, discovered);
     ASSERT_EQ(b->s, discovered);
     ASSERT_EQ(c->s, discovered);
@@ -259,9 +271,9 @@ TEST_F(GraphTest, DepthUndirected)
     ASSERT_EQ(a->t_disc, 4);
     ASSERT_EQ(b->t_disc, 5);
     ASSERT_EQ(c->t_disc, 6);
-    ASSERT_THAT(a->p, Eq(b));
-    ASSERT_THAT(b->p, Eq(c));
-    ASSERT_THAT(c->p, IsNull());
+    ASSERT_THAT(g.Parent(a), Eq(b));
+    ASSERT_THAT(g.Parent(b), Eq(c));
+    ASSERT_THAT(g.Parent(c), IsNull());
 }
 
 TEST_F(GraphTest, DepthDirected)
@@ -275,7 +287,7 @@ TEST_F(GraphTest, DepthDirected)
     auto discovered = Vertex<const char*>::Status::d;
     auto not_found = Vertex<const char*>::Status::nf;
     
-    g.Depth(a);
+    g.DepthInPlace(a);
     ASSERT_EQ(a->s, discovered);
     ASSERT_EQ(b->s, discovered);
     ASSERT_EQ(c->s, discovered);
@@ -285,11 +297,11 @@ TEST_F(GraphTest, DepthDirected)
     ASSERT_EQ(a->t_disc, 6);
     ASSERT_EQ(b->t_disc, 5);
     ASSERT_EQ(c->t_disc, 4);
-    ASSERT_THAT(a->p, IsNull());
-    ASSERT_THAT(b->p, Eq(a));
-    ASSERT_THAT(c->p, Eq(b));
+    ASSERT_THAT(g.Parent(a), IsNull());
+    ASSERT_THAT(g.Parent(b), Eq(a));
+    ASSERT_THAT(g.Parent(c), Eq(b));
     
-    g.Depth(b);
+    g.DepthInPlace(b);
     ASSERT_EQ(a->s, not_found);
     ASSERT_EQ(b->s, discovered);
     ASSERT_EQ(c->s, discovered);
@@ -299,11 +311,11 @@ TEST_F(GraphTest, DepthDirected)
     ASSERT_EQ(a->t_disc, 0);
     ASSERT_EQ(b->t_disc, 4);
     ASSERT_EQ(c->t_disc, 3);
-    ASSERT_THAT(a->p, IsNull());
-    ASSERT_THAT(b->p, IsNull());
-    ASSERT_THAT(c->p, Eq(b));
+    ASSERT_THAT(g.Parent(a), IsNull());
+    ASSERT_THAT(g.Parent(b), IsNull());
+    ASSERT_THAT(g.Parent(c), Eq(b));
     
-    g.Depth(c);
+    g.DepthInPlace(c);
     ASSERT_EQ(a->s, not_found);
     ASSERT_EQ(b->s, not_found);
     ASSERT_EQ(c->s, discovered);
@@ -313,9 +325,9 @@ TEST_F(GraphTest, DepthDirected)
     ASSERT_EQ(a->t_disc, 0);
     ASSERT_EQ(b->t_disc, 0);
     ASSERT_EQ(c->t_disc, 2);
-    ASSERT_THAT(a->p, IsNull());
-    ASSERT_THAT(b->p, IsNull());
-    ASSERT_THAT(c->p, IsNull());
+    ASSERT_THAT(g.Parent(a), IsNull());
+    ASSERT_THAT(g.Parent(b), IsNull());
+    ASSERT_THAT(g.Parent(c), IsNull());
 }
 
 TEST_F(GraphTest, ShortestPathUndirected)
@@ -329,7 +341,7 @@ TEST_F(GraphTest, ShortestPathUndirected)
     Vertex<const char*> v_b { std::move("b") };
     Vertex<const char*> v_c { std::move("c") };
     
-    g.Breadth(a);
+    g.BreadthInPlace(a);
     EXPECT_THAT(g.ShortestPath(a, b), ElementsAre(Pointee(v_a), Pointee(v_b)));
     EXPECT_THAT(g.ShortestPath(a, c), ElementsAre(Pointee(v_a), Pointee(v_b), Pointee(v_c)));
     EXPECT_THAT(g.ShortestPath(b, a), ElementsAre());
@@ -337,7 +349,7 @@ TEST_F(GraphTest, ShortestPathUndirected)
     EXPECT_THAT(g.ShortestPath(c, a), ElementsAre());
     EXPECT_THAT(g.ShortestPath(c, b), ElementsAre());
     
-    g.Breadth(b);
+    g.BreadthInPlace(b);
     EXPECT_THAT(g.ShortestPath(a, b), ElementsAre());
     EXPECT_THAT(g.ShortestPath(a, c), ElementsAre());
     EXPECT_THAT(g.ShortestPath(b, a), ElementsAre(Pointee(v_b), Pointee(v_a)));
@@ -345,7 +357,7 @@ TEST_F(GraphTest, ShortestPathUndirected)
     EXPECT_THAT(g.ShortestPath(c, a), ElementsAre());
     EXPECT_THAT(g.ShortestPath(c, b), ElementsAre());
     
-    g.Breadth(c);
+    g.BreadthInPlace(c);
     EXPECT_THAT(g.ShortestPath(a, b), ElementsAre());
     EXPECT_THAT(g.ShortestPath(a, c), ElementsAre());
     EXPECT_THAT(g.ShortestPath(b, a), ElementsAre(Pointee(v_b), Pointee(v_a)));
@@ -365,7 +377,7 @@ TEST_F(GraphTest, ShortestPathDirected)
     Vertex<const char*> v_b { std::move("b") };
     Vertex<const char*> v_c { std::move("c") };
 
-    g.Breadth(a);
+    g.BreadthInPlace(a);
     EXPECT_THAT(g.ShortestPath(a, b), ElementsAre(Pointee(v_a), Pointee(v_b)));
     EXPECT_THAT(g.ShortestPath(a, c), ElementsAre(Pointee(v_a), Pointee(v_b), Pointee(v_c)));
     EXPECT_THAT(g.ShortestPath(b, a), ElementsAre());
@@ -373,7 +385,7 @@ TEST_F(GraphTest, ShortestPathDirected)
     EXPECT_THAT(g.ShortestPath(c, a), ElementsAre());
     EXPECT_THAT(g.ShortestPath(c, b), ElementsAre());
     
-    g.Breadth(b);
+    g.BreadthInPlace(b);
     EXPECT_THAT(g.ShortestPath(a, b), ElementsAre());
     EXPECT_THAT(g.ShortestPath(a, c), ElementsAre());
     EXPECT_THAT(g.ShortestPath(b, a), ElementsAre());
@@ -381,7 +393,7 @@ TEST_F(GraphTest, ShortestPathDirected)
     EXPECT_THAT(g.ShortestPath(c, a), ElementsAre());
     EXPECT_THAT(g.ShortestPath(c, b), ElementsAre());
     
-    g.Breadth(c);
+    g.BreadthInPlace(c);
     EXPECT_THAT(g.ShortestPath(a, b), ElementsAre());
     EXPECT_THAT(g.ShortestPath(a, c), ElementsAre());
     EXPECT_THAT(g.ShortestPath(b, a), ElementsAre());
@@ -488,6 +500,20 @@ TEST_F(GraphTest, RemoveVertexDirected)
     ASSERT_THAT(g.ShortestPath(b, c), ElementsAre());
 }
 
+TEST(RemoveVertex, DropsParallelEdges)
+{
+    Graph<int> g{ { { 0, 1 }, { 1 } } };
+    auto vs = g.VertexSet();
+    g.AddEdge(0, 1);
+    ASSERT_EQ(g.OutDegree(vs[0]), 2);
+
+    g.RemoveVertex(vs[1]);
+    ASSERT_EQ(g.OutDegree(vs[0]), 0);
+    auto r = g.Breadth(vs[0]);
+    ASSERT_EQ(r.Dist(vs[0]), 0);
+    ASSERT_EQ(g.DegreeDistribution().in[0], 0);
+}
+
 TEST_F(GraphTest, AddVertexUndirected)
 {
     Graph<const char*>& g = undirected;
@@ -505,7 +531,7 @@ TEST_F(GraphTest, AddVertexUndirected)
     Vertex<const char*> v_c { std::move("c") };
     Vertex<const char*> v_d { std::move("d") };
 
-    g.Breadth(a);
+    g.BreadthInPlace(a);
     EXPECT_THAT(g.ShortestPath(a, b), ElementsAre(Pointee(v_a), Pointee(v_b)));
     EXPECT_THAT(g.ShortestPath(a, c), ElementsAre(Pointee(v_a), Pointee(v_b), Pointee(v_c)));
     EXPECT_THAT(g.ShortestPath(a, d), ElementsAre(Pointee(v_a), Pointee(v_b), Pointee(v_c), Pointee(v_d)));
@@ -519,7 +545,7 @@ TEST_F(GraphTest, AddVertexUndirected)
     EXPECT_THAT(g.ShortestPath(d, b), ElementsAre());
     EXPECT_THAT(g.ShortestPath(d, c), ElementsAre());
 
-    g.Breadth(b);
+    g.BreadthInPlace(b);
     EXPECT_THAT(g.ShortestPath(a, b), ElementsAre());
     EXPECT_THAT(g.ShortestPath(a, c), ElementsAre());
     EXPECT_THAT(g.ShortestPath(a, d), ElementsAre());
@@ -533,7 +559,7 @@ TEST_F(GraphTest, AddVertexUndirected)
     EXPECT_THAT(g.ShortestPath(d, b), ElementsAre());
     EXPECT_THAT(g.ShortestPath(d, c), ElementsAre());
 
-    g.Breadth(c);
+    g.BreadthInPlace(c);
     EXPECT_THAT(g.ShortestPath(a, b), ElementsAre());
     EXPECT_THAT(g.ShortestPath(a, c), ElementsAre());
     EXPECT_THAT(g.ShortestPath(a, d), ElementsAre());
@@ -547,7 +573,7 @@ TEST_F(GraphTest, AddVertexUndirected)
     EXPECT_THAT(g.ShortestPath(d, b), ElementsAre());
     EXPECT_THAT(g.ShortestPath(d, c), ElementsAre());
 
-    g.Breadth(d);
+    g.BreadthInPlace(d);
     EXPECT_THAT(g.ShortestPath(a, b), ElementsAre());
     EXPECT_THAT(g.ShortestPath(a, c), ElementsAre());
     EXPECT_THAT(g.ShortestPath(a, d), ElementsAre());
@@ -578,7 +604,7 @@ TEST_F(GraphTest, AddVertexDirected)
     Vertex<const char*> v_c{ std::move("c") };
     Vertex<const char*> v_d{ std::move("d") };
 
-    g.Breadth(a);
+    g.BreadthInPlace(a);
     EXPECT_THAT(g.ShortestPath(a, b), ElementsAre(Pointee(v_a), Pointee(v_b)));
     EXPECT_THAT(g.ShortestPath(a, c), ElementsAre(Pointee(v_a), Pointee(v_b), Pointee(v_c)));
     EXPECT_THAT(g.ShortestPath(a, d), ElementsAre(Pointee(v_a), Pointee(v_b), Pointee(v_c), Pointee(v_d)));
@@ -592,7 +618,7 @@ TEST_F(GraphTest, AddVertexDirected)
     EXPECT_THAT(g.ShortestPath(d, b), ElementsAre());
     EXPECT_THAT(g.ShortestPath(d, c), ElementsAre());
 
-    g.Breadth(b);
+    g.BreadthInPlace(b);
     EXPECT_THAT(g.ShortestPath(a, b), ElementsAre());
     EXPECT_THAT(g.ShortestPath(a, c), ElementsAre());
     EXPECT_THAT(g.ShortestPath(a, d), ElementsAre());
@@ -606,7 +632,7 @@ TEST_F(GraphTest, AddVertexDirected)
     EXPECT_THAT(g.ShortestPath(d, b), ElementsAre());
     EXPECT_THAT(g.ShortestPath(d, c), ElementsAre());
 
-    g.Breadth(c);
+    g.BreadthInPlace(c);
     EXPECT_THAT(g.ShortestPath(a, b), ElementsAre());
     EXPECT_THAT(g.ShortestPath(a, c), ElementsAre());
     EXPECT_THAT(g.ShortestPath(a, d), ElementsAre());
@@ -620,7 +646,7 @@ TEST_F(GraphTest, AddVertexDirected)
     EXPECT_THAT(g.ShortestPath(d, b), ElementsAre());
     EXPECT_THAT(g.ShortestPath(d, c), ElementsAre());
 
-    g.Breadth(d);
+    g.BreadthInPlace(d);
     EXPECT_THAT(g.ShortestPath(a, b), ElementsAre());
     EXPECT_THAT(g.ShortestPath(a, c), ElementsAre());
     EXPECT_THAT(g.ShortestPath(a, d), ElementsAre());
@@ -633,4 +659,856 @@ TEST_F(GraphTest, AddVertexDirected)
     EXPECT_THAT(g.ShortestPath(d, a), ElementsAre());
     EXPECT_THAT(g.ShortestPath(d, b), ElementsAre());
     EXPECT_THAT(g.ShortestPath(d, c), ElementsAre());
-}
\ No newline at end of file
+}
+
+TEST_F(GraphTest, FreezeDegrees)
+{
+    auto csr = this->directed.Freeze();
+    auto a = csr.Search("a");
+    auto b = csr.Search("b");
+    auto c = csr.Search("c");
+
+    ASSERT_EQ(csr.Size(), 3);
+    ASSERT_EQ(csr.Search("d"), csr.none);
+    ASSERT_EQ(csr.InDegree(a), 0);
+    ASSERT_EQ(csr.InDegree(b), 1);
+    ASSERT_EQ(csr.InDegree(c), 1);
+    ASSERT_EQ(csr.OutDegree(a), 1);
+    ASSERT_EQ(csr.OutDegree(b), 1);
+    ASSERT_EQ(csr.OutDegree(c), 0);
+}
+
+TEST_F(GraphTest, FreezeBreadthUndirected)
+{
+    auto csr = this->undirected.Freeze();
+    auto a = csr.Search("a");
+    auto b = csr.Search("b");
+    auto c = csr.Search("c");
+
+    auto r = csr.Breadth(b);
+    ASSERT_EQ(r.Dist(a), 1);
+    ASSERT_EQ(r.Dist(b), 0);
+    ASSERT_EQ(r.Dist(c), 1);
+    ASSERT_EQ(r.Parent(a), b);
+    ASSERT_EQ(r.Parent(b), csr.none);
+    EXPECT_THAT(r.ShortestPath(b, a), ElementsAre(b, a));
+    EXPECT_THAT(r.ShortestPath(a, c), ElementsAre());
+    EXPECT_THAT(csr.ShortestPath(a, c), ElementsAre(a, b, c));
+}
+
+TEST_F(GraphTest, FreezeDepthDirected)
+{
+    auto csr = this->directed.Freeze();
+    auto a = csr.Search("a");
+    auto b = csr.Search("b");
+    auto c = csr.Search("c");
+    auto not_found = Vertex<const char*>::Status::nf;
+
+    auto r = csr.Depth(a);
+    ASSERT_EQ(r.TimeFound(a), 1);
+    ASSERT_EQ(r.TimeFound(b), 2);
+    ASSERT_EQ(r.TimeFound(c), 3);
+    ASSERT_EQ(r.TimeDiscovered(a), 6);
+    ASSERT_EQ(r.TimeDiscovered(b), 5);
+    ASSERT_EQ(r.TimeDiscovered(c), 4);
+
+    r = csr.Depth(b);
+    ASSERT_EQ(r.S(a), not_found);
+    ASSERT_EQ(r.TimeFound(b), 1);
+    ASSERT_EQ(r.TimeDiscovered(b), 4);
+    ASSERT_EQ(r.Parent(c), b);
+}
+
+TEST_F(GraphTest, BreadthResultLeavesVerticesUntouched)
+{
+    const Graph<const char*>& g = this->undirected;
+    auto vs = this->undirected.VertexSet();
+    auto a = vs[0];
+    auto b = vs[1];
+    auto c = vs[2];
+
+    auto from_a = g.Breadth(a);
+    auto from_c = g.Breadth(c);
+    ASSERT_EQ(from_a.Dist(c), 2);
+    ASSERT_EQ(from_c.Dist(a), 2);
+    ASSERT_THAT(from_c.Parent(b), Eq(c));
+    EXPECT_THAT(from_a.ShortestPath(a, c), ElementsAre(a, b, c));
+    ASSERT_EQ(c->dist, 2);  // Set up by GraphTest::SetUp().
+    ASSERT_THAT(g.Parent(b), Eq(a));
+}
+
+TEST_F(GraphTest, DepthResultDirected)
+{
+    const Graph<const char*>& g = this->directed;
+    auto vs = this->directed.VertexSet();
+    auto a = vs[0];
+    auto b = vs[1];
+    auto c = vs[2];
+
+    auto r = g.Depth(b);
+    ASSERT_EQ(r.S(a), Vertex<const char*>::Status::nf);
+    ASSERT_EQ(r.TimeFound(b), 1);
+    ASSERT_EQ(r.TimeFound(c), 2);
+    ASSERT_EQ(r.TimeDiscovered(c), 3);
+    ASSERT_EQ(r.TimeDiscovered(b), 4);
+    ASSERT_THAT(r.Parent(c), Eq(b));
+}
+
+TEST(ParallelBreadth, MatchesSerial)
+{
+    std::vector<std::vector<int>> lists;
+    unsigned state = 12345;
+    for (int u = 0; u < 4000; ++u) {    // Random graph, some thousand edges, skewed towards low ids.
+        std::vector<int> list{ u };
+        for (int k = 0; k < 4; ++k) {
+            state = state * 1103515245 + 12345;
+            int v = static_cast<int>((state >> 8) % 4000);
+            list.push_back(v * v / 4000);
+        }
+        lists.push_back(list);
+    }
+    Graph<int> g{ lists };
+    const Graph<int>& cg = g;
+    auto csr = g.Freeze();
+    ThreadPool pool{ 4 };
+
+    auto source = g.VertexSet()[0];
+    auto serial = cg.Breadth(source);
+    auto parallel = cg.Breadth(source, pool);
+    ASSERT_EQ(serial.s, parallel.s);
+    ASSERT_EQ(serial.dist, parallel.dist);
+    ASSERT_EQ(serial.p, parallel.p);
+
+    auto csr_serial = csr.Breadth(0);
+    auto csr_parallel = csr.Breadth(0, pool);
+    ASSERT_EQ(csr_serial.dist, csr_parallel.dist);
+    ASSERT_EQ(csr_serial.p, csr_parallel.p);
+    ASSERT_EQ(csr_serial.dist, serial.dist);
+}
+
+TEST(DirectionOptimizing, MatchesTopDownDistances)
+{
+    std::vector<std::vector<int>> lists;
+    unsigned state = 777;
+    for (int u = 0; u < 3000; ++u) {
+        std::vector<int> list{ u };
+        for (int k = 0; k < 6; ++k) {
+            state = state * 1103515245 + 12345;
+            list.push_back(static_cast<int>((state >> 8) % 3000));
+        }
+        lists.push_back(list);
+    }
+    Graph<int> g{ lists };
+    auto csr = g.Freeze();
+
+    auto top_down = csr.Breadth(0);
+    for (DirectionOptimizing params : { DirectionOptimizing{}, DirectionOptimizing{ 1 << 20, 1 << 20 } }) {
+        auto hybrid = csr.Breadth(0, params);
+        ASSERT_EQ(top_down.dist, hybrid.dist);
+        ASSERT_EQ(top_down.s, hybrid.s);
+        for (std::uint32_t v = 1; v < csr.Size(); ++v) {
+            if (hybrid.Found(v)) {
+                auto u = hybrid.Parent(v);
+                ASSERT_EQ(hybrid.Dist(u) + 1, hybrid.Dist(v));
+                ASSERT_NE(std::find(csr.EdgesBegin(u), csr.EdgesEnd(u), v), csr.EdgesEnd(u));
+            }
+        }
+    }
+}
+
+TEST(Bitset, WordOperations)
+{
+    Bitset a{ 200 };
+    Bitset b{ 200 };
+    ASSERT_TRUE(a.None());
+
+    a.Set(3);
+    a.Set(130);
+    b.Set(64);
+    b.Set(199);
+    ASSERT_FALSE(a.TestAndSet(0));
+    ASSERT_TRUE(a.TestAndSet(0));
+    a |= b;
+    ASSERT_FALSE(a.None());
+    ASSERT_EQ(a.Count(), 5);
+
+    std::vector<std::size_t> members;
+    a.ForEach([&](std::size_t i) { members.push_back(i); });
+    EXPECT_THAT(members, ElementsAre(0, 3, 64, 130, 199));
+
+    a.Reset(64);
+    ASSERT_FALSE(a.Test(64));
+    a.Clear();
+    ASSERT_TRUE(a.None());
+}
+
+TEST(DeepGraph, DepthAndShortestPath)
+{
+    const int n = 200000;   // Far deeper than a recursive descent could go.
+    std::vector<std::vector<int>> chain(n);
+    for (int i = 0; i < n; ++i) {
+        chain[i] = i + 1 < n ? std::vector<int>{ i, i + 1 } : std::vector<int>{ i };
+    }
+    Graph<int> g{ chain };
+    auto& vs = g.VertexSet();
+
+    g.DepthInPlace(vs[0]);
+    ASSERT_EQ(vs[n - 1]->t_found, n);
+    ASSERT_EQ(vs[n - 1]->t_disc, n + 1);
+    ASSERT_EQ(vs[0]->t_disc, 2 * n);
+    ASSERT_THAT(g.Parent(vs[n - 1]), Eq(vs[n - 2]));
+
+    g.BreadthInPlace(vs[0]);
+    auto path = g.ShortestPath(vs[0], vs[n - 1]);
+    ASSERT_EQ(path.size(), n);
+    ASSERT_THAT(path.front(), Eq(vs[0]));
+    ASSERT_THAT(path.back(), Eq(vs[n - 1]));
+    ASSERT_THAT(g.ShortestPath(vs[1], vs[0]), ElementsAre());
+}
+
+TEST(StronglyConnectedComponents, Condensation)
+{
+    Graph<const char*> g {{  // (a <-> b) -> (c -> d -> e -> c) -> f, and a -> f
+        { "a", "b", "f" },
+        { "b", "a", "c" },
+        { "c", "d" },
+        { "d", "e" },
+        { "e", "c", "f" },
+        { "f" }
+    }};
+    auto& vs = g.VertexSet();
+    auto id = [&](const char* item) {
+        return std::find_if(vs.begin(), vs.end(), [&](auto v) { return std::string{ v->item } == item; }) - vs.begin();
+    };
+
+    auto c = g.StronglyConnectedComponents();
+    ASSERT_EQ(c.Count(), 3);
+    ASSERT_EQ(c.Of(id("a")), c.Of(id("b")));
+    ASSERT_EQ(c.Of(id("c")), c.Of(id("d")));
+    ASSERT_EQ(c.Of(id("c")), c.Of(id("e")));
+    ASSERT_LT(c.Of(id("a")), c.Of(id("c")));
+    ASSERT_LT(c.Of(id("c")), c.Of(id("f")));
+
+    auto ab = c.Of(id("a"));
+    std::vector<std::uint32_t> from_ab{ c.EdgesBegin(ab), c.EdgesEnd(ab) };
+    std::sort(from_ab.begin(), from_ab.end());
+    EXPECT_THAT(from_ab, ElementsAre(c.Of(id("c")), c.Of(id("f"))));    // a -> f and b -> c, once each.
+
+    auto csr = g.Freeze();
+    auto frozen = csr.StronglyConnectedComponents();
+    ASSERT_EQ(frozen.component, c.component);
+    ASSERT_EQ(frozen.targets.size(), c.targets.size());
+}
+
+TEST(Dijkstra, WeightedShortestPath)
+{
+    Graph<const char*> g {{ { "s" } }};
+    g.AddEdge("s", "a", 1);     // s -> a -> b -> t costs 3; s -> t costs 10.
+    g.AddEdge("a", "b", 1);
+    g.AddEdge("b", "t", 1);
+    g.AddEdge("s", "t", 10);
+    g.AddEdge("t", "u");
+    auto& vs = g.VertexSet();
+    auto s = vs[0];
+    auto a = vs[1];
+    auto b = vs[2];
+    auto t = vs[3];
+    auto u = vs[4];
+
+    ASSERT_EQ(g.Weight(s, t), 10);
+    ASSERT_EQ(g.Weight(t, u), 1);
+
+    const Graph<const char*>& cg = g;
+    auto r = cg.Dijkstra(s);
+    ASSERT_EQ(r.Dist(t), 3);
+    ASSERT_EQ(r.Dist(u), 4);
+    EXPECT_THAT(r.ShortestPath(s, t), ElementsAre(s, a, b, t));
+    EXPECT_THAT(cg.Breadth(s).ShortestPath(s, t), ElementsAre(s, t));
+
+    auto early = cg.Dijkstra(s, t);
+    ASSERT_TRUE(early.Settled(t));
+    ASSERT_FALSE(early.Settled(u));
+    EXPECT_THAT(early.ShortestPath(s, t), ElementsAre(s, a, b, t));
+
+    auto csr = g.Freeze();
+    auto frozen = csr.Dijkstra(0, 3);
+    ASSERT_EQ(frozen.Dist(3), 3);
+    EXPECT_THAT(frozen.ShortestPath(0, 3), ElementsAre(0, 1, 2, 3));
+
+    g.AddEdge("s", "t", 10);    // Parallel to the first s -> t.
+    g.RemoveEdge("s", "t");
+    ASSERT_EQ(g.Weight(s, t), 10);
+    g.RemoveEdge("s", "t");
+    ASSERT_EQ(g.Weight(s, t), 1);
+}
+
+TEST(IndexedHeap, DecreaseKey)
+{
+    IndexedHeap<double> heap{ 8 };
+    for (std::uint32_t v = 0; v < 8; ++v) {
+        heap.Push(v, 10.0 + v);
+    }
+    heap.DecreaseKey(6, 1);
+    heap.DecreaseKey(3, 2);
+    ASSERT_EQ(heap.Pop().first, 6);
+    ASSERT_EQ(heap.Pop().first, 3);
+    ASSERT_FALSE(heap.Contains(3));
+    for (std::uint32_t expected : { 0, 1, 2, 4, 5, 7 }) {
+        ASSERT_EQ(heap.Pop().first, expected);
+    }
+    ASSERT_TRUE(heap.Empty());
+}
+
+TEST(Bidirectional, MatchesBreadthDistances)
+{
+    std::vector<std::vector<int>> lists;
+    unsigned state = 4242;
+    for (int u = 0; u < 2000; ++u) {
+        std::vector<int> list{ u };
+        for (int k = 0; k < 2; ++k) {
+            state = state * 1103515245 + 12345;
+            list.push_back(static_cast<int>((state >> 8) % 2000));
+        }
+        lists.push_back(list);
+    }
+    Graph<int> g{ lists };
+    const Graph<int>& cg = g;
+    auto csr = g.Freeze();
+
+    for (std::uint32_t s : { 0u, 17u, 999u }) {
+        auto full = csr.Breadth(s);
+        for (std::uint32_t v = 0; v < csr.Size(); v += 7) {
+            auto path = csr.ShortestPath(s, v, Bidirectional{});
+            if (!full.Found(v)) {
+                ASSERT_TRUE(path.empty());
+                continue;
+            }
+            ASSERT_EQ(path.size(), full.Dist(v) + 1);
+            ASSERT_EQ(path.front(), s);
+            ASSERT_EQ(path.back(), v);
+            for (std::size_t i = 1; i < path.size(); ++i) {
+                ASSERT_NE(std::find(csr.EdgesBegin(path[i - 1]), csr.EdgesEnd(path[i - 1]), path[i]), csr.EdgesEnd(path[i - 1]));
+            }
+        }
+    }
+
+    auto& vs = g.VertexSet();
+    auto full = cg.Breadth(vs[5]);
+    auto path = cg.ShortestPath(vs[5], vs[1500], Bidirectional{});
+    ASSERT_EQ(path.size(), full.Found(vs[1500]) ? full.Dist(vs[1500]) + 1 : 0);
+    EXPECT_THAT(cg.ShortestPath(vs[5], vs[5], Bidirectional{}), ElementsAre(vs[5]));
+}
+
+TEST(AlternateShortestPath, GridMatchesDijkstra)
+{
+    const int w = 30;
+    Graph<int> g{ { { 0 } } };
+    for (int y = 0; y < w; ++y) {   // Grid, 4-neighbour, with every edge out of column 10 weighing 5.
+        for (int x = 0; x < w; ++x) {
+            const int u = y * w + x;
+            const double cost = x == 10 ? 5 : 1;
+            if (x + 1 < w) {
+                g.AddEdge(u, u + 1, cost);
+                g.AddEdge(u + 1, u, x + 1 == 10 ? 5 : 1);
+            }
+            if (y + 1 < w) {
+                g.AddEdge(u, u + w, cost);
+                g.AddEdge(u + w, u, cost);
+            }
+        }
+    }
+    const Graph<int>& cg = g;
+    auto csr = g.Freeze();
+    auto manhattan = [&](int target) {
+        return [&csr, target](std::uint32_t v) {
+            const int item = csr.Item(v);
+            return static_cast<double>(std::abs(item % w - target % w) + std::abs(item / w - target / w));
+        };
+    };
+
+    for (auto [s, t] : { std::pair{ 0, w * w - 1 }, std::pair{ 5 * w + 2, 20 * w + 25 }, std::pair{ 29, 0 } }) {
+        const std::uint32_t source = csr.Search(s);
+        const std::uint32_t target = csr.Search(t);
+        auto dijkstra = csr.Dijkstra(source);
+        auto path = csr.AlternateShortestPath(source, target, manhattan(t));
+        ASSERT_EQ(path.front(), source);
+        ASSERT_EQ(path.back(), target);
+        double length = 0;
+        for (std::size_t i = 1; i < path.size(); ++i) {
+            length += g.Weight(g.VertexSet()[path[i - 1]], g.VertexSet()[path[i]]);
+        }
+        ASSERT_EQ(length, dijkstra.Dist(target));
+    }
+
+    auto& vs = g.VertexSet();
+    auto path = cg.AlternateShortestPath(vs[csr.Search(0)], vs[csr.Search(w - 1)], [](Vertex<int>*) { return 0.0; });
+    ASSERT_EQ(path.size(), w);  // Every path leaves column 10 at least once: straight along the row is shortest.
+}
+
+TEST(MultiSourceBreadth, NearestSource)
+{
+    std::vector<std::vector<int>> chain(10);    // 0 -> 1 -> ... -> 9
+    for (int i = 0; i < 10; ++i) {
+        chain[i] = i + 1 < 10 ? std::vector<int>{ i, i + 1 } : std::vector<int>{ i };
+    }
+    Graph<int> g{ chain };
+    const Graph<int>& cg = g;
+    auto& vs = g.VertexSet();
+
+    auto r = cg.Breadth(std::vector<Vertex<int>*>{ vs[6], vs[2], vs[2] });
+    ASSERT_EQ(r.Dist(vs[2]), 0);
+    ASSERT_EQ(r.Dist(vs[5]), 3);
+    ASSERT_EQ(r.Dist(vs[9]), 3);
+    ASSERT_EQ(r.Source(vs[5]), vs[2]);
+    ASSERT_EQ(r.Source(vs[7]), vs[6]);
+    ASSERT_FALSE(r.Found(vs[1]));
+    ASSERT_EQ(r.Source(vs[1]), nullptr);
+    EXPECT_THAT(r.ShortestPath(r.Source(vs[4]), vs[4]), ElementsAre(vs[2], vs[3], vs[4]));
+
+    auto csr = g.Freeze();
+    auto frozen = csr.Breadth(std::vector<std::uint32_t>{ 6, 2, 2 });
+    ASSERT_EQ(frozen.dist, r.dist);
+    for (std::uint32_t v = 0; v < csr.Size(); ++v) {
+        ASSERT_EQ(frozen.Source(v), r.Source(vs[v]) ? r.Source(vs[v])->id : CsrGraph<int>::none);
+    }
+}
+
+TEST(BatchBreadth, MatchesBreadthPerSource)
+{
+    std::vector<std::vector<int>> lists;
+    unsigned state = 99;
+    for (int u = 0; u < 1500; ++u) {
+        std::vector<int> list{ u };
+        for (int k = 0; k < 3; ++k) {
+            state = state * 1103515245 + 12345;
+            list.push_back(static_cast<int>((state >> 8) % 1500));
+        }
+        lists.push_back(list);
+    }
+    Graph<int> g{ lists };
+    const Graph<int>& cg = g;
+    auto csr = g.Freeze();
+
+    std::vector<std::uint32_t> sources;  // Two batches, the second partial, with a repeat and an invalid id.
+    for (std::uint32_t k = 0; k < 100; ++k) {
+        sources.push_back(k * 13 % 1500);
+    }
+    sources.push_back(sources[3]);
+    sources.push_back(CsrGraph<int>::none);
+    auto batch = csr.BatchBreadth(sources);
+    for (std::size_t k = 0; k + 1 < sources.size(); ++k) {
+        ASSERT_EQ(batch.dist[k], csr.Breadth(sources[k]).dist);
+    }
+    ASSERT_FALSE(batch.Found(sources.size() - 1, 0));
+
+    auto& vs = g.VertexSet();
+    auto graph_batch = cg.BatchBreadth({ vs[7], vs[700] });
+    ASSERT_EQ(graph_batch.dist[0], cg.Breadth(vs[7]).dist);
+    ASSERT_EQ(graph_batch.Dist(1, vs[700]), 0);
+}
+
+static void DynamicUpdates(bool keep_in_edges)
+{
+    std::vector<std::vector<int>> lists;
+    unsigned state = 2024;
+    auto next = [&state](int n) {
+        state = state * 1103515245 + 12345;
+        return static_cast<int>((state >> 8) % n);
+    };
+    for (int u = 0; u < 400; ++u) {
+        lists.push_back({ u, next(400), next(400) });
+    }
+    Graph<int> g{ lists };
+    if (keep_in_edges) {
+        g.KeepInEdges();
+    }
+    auto source = g.VertexSet()[0];
+    g.BreadthInPlace(source, Dynamic{});
+
+    auto check = [&] {
+        const Graph<int>& cg = g;
+        auto fresh = cg.Breadth(source);
+        for (Vertex<int>* v : g.VertexSet()) {
+            ASSERT_EQ(v->dist, fresh.Dist(v)) << "vertex " << v->item;
+            ASSERT_EQ(v->s, fresh.S(v));
+            if (v != source && fresh.Found(v)) {
+                ASSERT_EQ(g.Parent(v)->dist + 1, v->dist);
+                ASSERT_THAT(g.Edges(g.Parent(v)).Search(v->item), NotNull());
+            }
+        }
+        if (keep_in_edges) {
+            auto degrees = g.DegreeDistribution();
+            for (Vertex<int>* v : g.VertexSet()) {
+                for (Vertex<int>* u : g.InEdges(v)) {
+                    ASSERT_THAT(g.Edges(u).Search(v->item), NotNull());
+                }
+                int in{};
+                for (Vertex<int>* u : g.VertexSet()) {
+                    for (Vertex<int>* w : g.Edges(u)) {
+                        in += w == v;
+                    }
+                }
+                ASSERT_EQ(degrees.in[v->id], in);
+            }
+        }
+    };
+    for (int step = 0; step < 300; ++step) {
+        switch (step % 4) {
+        case 0:
+            g.AddEdge(next(400), next(400));
+            break;
+        case 1: {   // Cut a tree edge, where one exists.
+            Vertex<int>* v = g.VertexSet()[1 + next(static_cast<int>(g.VertexSet().size()) - 1)];
+            if (Vertex<int>* u = g.Parent(v)) {
+                g.RemoveEdge(u->item, v->item);
+            }
+            break;
+        }
+        case 2:
+            g.AddVertex({ 1000 + step, next(400), next(400) });
+            g.AddEdge(next(400), 1000 + step);
+            break;
+        case 3:
+            g.RemoveVertex(g.VertexSet()[1 + next(static_cast<int>(g.VertexSet().size()) - 1)]);
+            break;
+        }
+        check();
+    }
+
+    g.Transpose();
+    check();
+
+    Graph<int> other{ { { 0 } } };
+    g.RemoveVertex(other.VertexSet()[0]);   // Not g's: changes nothing, and the tree is still kept.
+    g.RemoveVertex(nullptr);
+
+    // A chain of doubled edges, cut off at its head: each link is reached twice from the one before, but its
+    // subtree must be repaired once, not once per path to it.
+    const int first = 5000;
+    const int links = 20;
+    g.AddEdge(source->item, first);
+    for (int k = first; k < first + links; ++k) {
+        g.AddEdge(k, k + 1);
+        g.AddEdge(k, k + 1);
+    }
+    check();
+    g.RemoveEdge(first, first + 1);     // One of a pair: the tree stands.
+    check();
+    g.RemoveEdge(source->item, first);
+    check();
+}
+
+TEST_F(GraphTest, DegreesFollowUpdates)
+{
+    Graph<const char*>& g = this->directed;    // a -> b -> c
+    auto& vs = g.VertexSet();
+
+    g.AddEdge("c", "a");
+    g.AddEdge("a", "c");
+    g.AddEdge("d", "b");
+    ASSERT_EQ(g.InDegree(vs[1]), 2);
+    ASSERT_EQ(g.InDegree(vs[2]), 2);
+    g.RemoveEdge("a", "c");
+    g.RemoveEdge("a", "c");     // No longer held: no change.
+    ASSERT_EQ(g.InDegree(vs[2]), 1);
+
+    g.RemoveVertex(vs[0]);      // Drops a -> b and c -> a.
+    auto degrees = g.DegreeDistribution();
+    ASSERT_EQ(vs.size(), 3);
+    EXPECT_THAT(degrees.in, ElementsAre(1, 1, 0));     // b, c, d
+    EXPECT_THAT(degrees.out, ElementsAre(1, 0, 1));
+
+    g.Transpose();
+    degrees = g.DegreeDistribution();
+    EXPECT_THAT(degrees.in, ElementsAre(1, 0, 1));
+    EXPECT_THAT(degrees.out, ElementsAre(1, 1, 0));
+    ASSERT_EQ(g.InDegree(vs[2]), 1);
+}
+
+TEST(DynamicBreadth, RepairsAfterUpdates)
+{
+    DynamicUpdates(false);
+}
+
+TEST(DynamicBreadth, RepairsThroughInEdges)
+{
+    DynamicUpdates(true);
+}
+
+TEST_F(GraphTest, TransposeWithInEdges)
+{
+    Graph<const char*>& g = this->directed;    // a -> b -> c
+    auto& vs = g.VertexSet();
+    auto sorted = [](const auto& list) {
+        std::vector<Vertex<const char*>*> v;
+        for (auto u : list) {
+            v.push_back(u);
+        }
+        std::sort(v.begin(), v.end(), [](auto a, auto b) { return a->id < b->id; });
+        return v;
+    };
+    g.AddEdge("a", "c", 4);
+    g.KeepInEdges();
+    EXPECT_THAT(sorted(g.InEdges(vs[2])), ElementsAre(vs[0], vs[1]));
+
+    g.Transpose();
+    EXPECT_THAT(sorted(g.Edges(vs[2])), ElementsAre(vs[0], vs[1]));
+    EXPECT_THAT(sorted(g.InEdges(vs[0])), ElementsAre(vs[1], vs[2]));
+    ASSERT_EQ(g.OutDegree(vs[0]), 0);
+    ASSERT_EQ(g.InDegree(vs[0]), 2);
+    ASSERT_EQ(g.Weight(vs[2], vs[0]), 4);
+    ASSERT_EQ(g.Weight(vs[0], vs[2]), 1);
+
+    g.Transpose();
+    ASSERT_EQ(g.Weight(vs[0], vs[2]), 4);
+    g.RemoveVertex(vs[1]);
+    EXPECT_THAT(sorted(g.Edges(vs[0])), ElementsAre(vs[1]));
+    EXPECT_THAT(sorted(g.InEdges(vs[1])), ElementsAre(vs[0]));
+}
+
+TEST(Arena, NodesComeFromTheGivenResource)
+{
+    Counting counting;
+
+    {
+        Graph<int> g{ { { 0, 1, 2 }, { 1, 2 }, { 2, 0 } }, &counting };
+        ASSERT_GE(counting.total, 3 + 5);   // At least the vertices and the edge nodes.
+        g.AddEdge(2, 3);
+        g.RemoveEdge(0, 1);
+        g.KeepInEdges();
+        g.Transpose();
+        auto moved{ std::move(g) };
+        ASSERT_EQ(moved.InDegree(moved.VertexSet()[0]), 1); // 0 -> 2 reversed.
+    }
+    ASSERT_EQ(counting.live, 0);    // Every node handed back on destruction.
+}
+
+TEST(Queue, FirstInFirstOut)
+{
+    Counting counting;
+    {
+        Queue<DirectedNode, int> Q{ &counting };
+        for (int i = 0; i < 4; ++i) {
+            Q.Enqueue(int{ i });
+        }
+        auto* n = Q.Dequeue();
+        ASSERT_EQ(n->item, 0);
+        Destroy(Q.Resource(), n);
+        Q.Enqueue(4);
+        ASSERT_EQ(Q.Size(), 4);
+        for (int i = 1; i <= 2; ++i) {
+            n = Q.Dequeue();
+            ASSERT_EQ(n->item, i);
+            Destroy(Q.Resource(), n);
+        }
+        ASSERT_EQ(counting.live, 2);
+    }
+    ASSERT_EQ(counting.live, 0);    // The nodes still queued are handed back on destruction.
+}
+
+TEST(Node, NoVtable)
+{
+    static_assert(std::is_standard_layout_v<Vertex<int>>);
+    static_assert(std::is_standard_layout_v<BiDirectionalNode<Vertex<int>*>>);
+    static_assert(!std::is_polymorphic_v<Vertex<int>>);
+    static_assert(std::is_trivially_destructible_v<BiDirectionalNode<Vertex<int>*>>);
+    ASSERT_EQ(sizeof(BiDirectionalNode<Vertex<int>*>), 3 * sizeof(void*));   // Item and two links.
+    ASSERT_EQ(sizeof(Vertex<int>), 7 * sizeof(int));  // Predecessor by id, no links.
+}
+
+TEST(BulkBuild, MatchesListConstruction)
+{
+    const std::vector<std::vector<int>> lists{ { 0, 1, 2 }, { 1, 2, 3 }, { 3, 0 }, { 2, 4 }, { 5, 4, 0 } };
+    std::vector<std::pair<int, int>> pairs;
+    for (const auto& list : lists) {
+        for (auto i = list.begin() + 1; i != list.end(); ++i) {
+            pairs.emplace_back(list.front(), *i);
+        }
+    }
+
+    Graph<int> g{ lists };
+    Graph<int> bulk{ pairs.data(), pairs.size() };
+    auto items = [](Graph<int>& h, Vertex<int>* v) {
+        std::vector<int> out;
+        for (Vertex<int>* u : h.Edges(v)) {
+            out.push_back(u->item);
+        }
+        std::sort(out.begin(), out.end());
+        return out;
+    };
+    ASSERT_EQ(bulk.VertexSet().size(), g.VertexSet().size());
+    for (Vertex<int>* v : g.VertexSet()) {
+        Vertex<int>* w = bulk.VertexSet()[v->id];
+        ASSERT_EQ(w->item, v->item);
+        ASSERT_EQ(items(bulk, w), items(g, v));
+        ASSERT_EQ(bulk.InDegree(w), g.InDegree(v));
+    }
+
+    auto csr = CsrGraph<int>::FromEdges(pairs.data(), pairs.size());
+    auto frozen = g.Freeze();
+    ASSERT_EQ(csr.Size(), frozen.Size());
+    for (std::uint32_t v = 0; v < csr.Size(); ++v) {
+        std::uint32_t w = frozen.Search(csr.Item(v));
+        ASSERT_EQ(csr.OutDegree(v), frozen.OutDegree(w));
+        ASSERT_EQ(csr.InDegree(v), frozen.InDegree(w));
+        ASSERT_EQ(csr.Breadth(csr.Search(0)).Dist(v), frozen.Breadth(frozen.Search(0)).Dist(w));
+    }
+    ASSERT_EQ(csr.Item(*csr.EdgesBegin(csr.Search(0))), 1);   // Out-edges keep the order given.
+}
+
+TEST(DenseIds, NumbersInOrderOfFirstSight)
+{
+    DenseIds<int> ids;
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(ids(i << 10), static_cast<std::uint32_t>(i));  // Through several doublings of the table.
+    }
+    for (int i = 999; i >= 0; --i) {
+        ASSERT_EQ(ids(i << 10), static_cast<std::uint32_t>(i));
+    }
+    ASSERT_EQ(ids.Size(), 1000u);
+    ASSERT_EQ(ids.Item(7), 7 << 10);
+
+    std::string b{ "b" };
+    DenseIds<const char*> strings;
+    ASSERT_EQ(strings("a"), 0u);
+    ASSERT_EQ(strings("b"), 1u);
+    ASSERT_EQ(strings(b.c_str()), 1u);  // By content, as ItemEqual compares C-strings.
+}
+
+TEST(CsrFile, OpenServesQueriesFromTheMappedFile)
+{
+    Graph<int> g{ { { 0, 1, 2 }, { 1, 3 }, { 2, 3 }, { 3, 4 }, { 5, 0 } } };
+    g.AddEdge(2, 3, 0.5);
+    auto csr = g.Freeze();
+    const std::string path = (std::filesystem::temp_directory_path() / "GraphTest.csr").string();
+    ASSERT_TRUE(csr.Save(path));
+
+    {
+        auto mapped = CsrGraph<int>::Open(path);
+        ASSERT_TRUE(mapped);
+        ASSERT_EQ(mapped->Size(), csr.Size());
+        ASSERT_EQ(mapped->Search(42), CsrGraph<int>::none);
+        for (std::uint32_t v = 0; v < csr.Size(); ++v) {
+            ASSERT_EQ(mapped->Item(v), csr.Item(v));
+            ASSERT_EQ(mapped->Search(csr.Item(v)), v);
+            ASSERT_EQ(mapped->InDegree(v), csr.InDegree(v));
+            ASSERT_EQ(mapped->Breadth(0).Dist(v), csr.Breadth(0).Dist(v));
+            ASSERT_EQ(mapped->Dijkstra(0).Dist(v), csr.Dijkstra(0).Dist(v));
+        }
+        const std::uint32_t s = mapped->Search(0);
+        const std::uint32_t t = mapped->Search(4);
+        ASSERT_EQ(mapped->ShortestPath(s, t), csr.ShortestPath(s, t));
+        ASSERT_EQ(mapped->ShortestPath(s, t, Bidirectional{}).size(), 4u);
+    }
+
+    ASSERT_FALSE(CsrGraph<long long>::Open(path));  // Another item size.
+    {
+        std::fstream f{ path, std::ios::in | std::ios::out | std::ios::binary };
+        f.write("NOTAGRPH", 8);
+    }
+    ASSERT_FALSE(CsrGraph<int>::Open(path));
+    std::filesystem::remove(path);
+    ASSERT_FALSE(CsrGraph<int>::Open(path));
+}
+
+TEST(EdgeList, StreamsChunksIntoAddEdges)
+{
+    const std::string path = (std::filesystem::temp_directory_path() / "GraphTest.edges").string();
+    {
+        std::ofstream out{ path, std::ios::binary };
+        out << "# source target\n"
+               "0 1\n"
+               "0\t2\r\n"
+               "\n"
+               "1,3\n"
+               "  2 , 3 , 7.5\n"        // A weight column, ignored.
+               "3 x\n"                  // Malformed.
+               "1234567890123 4\n"      // Out of range for int.
+               "3 4";                   // No final line break.
+    }
+
+    for (unsigned threads : { 1u, 3u }) {
+        for (std::size_t chunk : { std::size_t{ 4 }, std::size_t{ 7 }, std::size_t{ 1 } << 16 }) {   // Down to less than a line.
+            ThreadPool pool{ threads };
+            Graph<int> g{ {} };
+            EdgeListStats stats = ReadEdgeList<int>(path, pool, [&g](const std::pair<int, int>* edges, std::size_t count) {
+                g.AddEdges(edges, count);
+            }, chunk);
+            ASSERT_TRUE(stats.opened);
+            ASSERT_EQ(stats.edges, 5u);
+            ASSERT_EQ(stats.malformed, 2u);
+
+            auto vs = g.VertexSet();
+            ASSERT_EQ(vs.size(), 5u);
+            for (int v = 0; v < 5; ++v) {
+                ASSERT_EQ(vs[v]->item, v);   // Numbered in file order, whatever the chunking.
+            }
+            ASSERT_EQ(g.OutDegree(vs[0]), 2);
+            ASSERT_EQ(g.InDegree(vs[3]), 2);
+            ASSERT_EQ(g.Breadth(vs[0]).Dist(vs[4]), 3);
+        }
+    }
+    std::filesystem::remove(path);
+
+    ThreadPool pool{ 1 };
+    ASSERT_FALSE(ReadEdgeList<int>(path, pool, [](const std::pair<int, int>*, std::size_t) {}).opened);
+}
+
+TEST(Interner, IdsByContent)
+{
+    Interner names;
+    std::string b{ "b" };
+    ASSERT_EQ(names.Intern("a"), 0u);
+    ASSERT_EQ(names.Intern(b), 1u);
+    ASSERT_EQ(names.Intern(std::string{ "a" }), 0u);  // Not the same storage.
+    ASSERT_EQ(names.Intern(""), 2u);
+    ASSERT_EQ(names.Find("b"), 1u);
+    ASSERT_EQ(names.Find("c"), Interner::none);
+    b[0] = 'x';
+    ASSERT_EQ(names.String(1), "b");    // A copy of its own.
+    ASSERT_STREQ(names.CString(0), "a");
+    ASSERT_EQ(names.Size(), 3u);
+
+    std::vector<std::vector<const char*>> lists{ { "a", "b", "c" }, { "b", "c" }, { "c", "a" } };
+    Graph<Interner::Id> g{ names.Intern(lists) };
+    Graph<const char*> h{ lists };
+    auto vs = g.VertexSet();
+    ASSERT_EQ(vs.size(), h.VertexSet().size());
+    for (std::size_t v = 0; v < vs.size(); ++v) {
+        ASSERT_STREQ(names.CString(vs[v]->item), h.VertexSet()[v]->item);
+        ASSERT_EQ(g.OutDegree(vs[v]), h.OutDegree(h.VertexSet()[v]));
+    }
+}
+
+TEST(Interner, EdgeListOfNames)
+{
+    const std::string path = (std::filesystem::temp_directory_path() / "GraphTest.names").string();
+    {
+        std::ofstream out{ path, std::ios::binary };
+        out << "alice,bob\nbob,carol\ncarol,alice\nalice,carol\n";
+    }
+    Interner names;
+    Graph<Interner::Id> g{ {} };
+    ThreadPool pool{ 2 };
+    auto view = [](const char* first, const char* last, std::string_view& item) {
+        item = { first, static_cast<std::size_t>(last - first) };
+        return true;
+    };
+    std::vector<std::pair<Interner::Id, Interner::Id>> ids;
+    auto stats = ReadEdgeList<std::string_view>(path, pool, [&](const std::pair<std::string_view, std::string_view>* edges, std::size_t count) {
+        ids.clear();
+        for (std::size_t e = 0; e < count; ++e) {
+            const Interner::Id source = names.Intern(edges[e].first);  // Sources first, as AddEdges() numbers them.
+            ids.emplace_back(source, names.Intern(edges[e].second));
+        }
+        g.AddEdges(ids.data(), ids.size());
+    }, 8, view);
+    std::filesystem::remove(path);
+
+    ASSERT_EQ(stats.edges, 4u);
+    ASSERT_EQ(names.Size(), 3u);
+    auto vs = g.VertexSet();
+    ASSERT_EQ(names.String(vs[0]->item), "alice");
+    ASSERT_EQ(g.OutDegree(vs[names.Find("alice")]), 2);
+    ASSERT_EQ(g.InDegree(vs[names.Find("alice")]), 1);
+}
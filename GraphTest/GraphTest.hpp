@@ -2,6 +2,7 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock-matchers.h"
 #include "../Graph.hpp"
+#include "../Counting.hpp"
 
 using ::testing::IsNull;
 using ::testing::NotNull;
@@ -16,8 +17,8 @@ protected:
     void SetUp() override
     {
         auto vs = directed.VertexSet();
-        undirected.Breadth(vs[0]);      // Index
-        directed.Breadth(vs[0]);
+        undirected.BreadthInPlace(vs[0]);      // Index
+        directed.BreadthInPlace(vs[0]);
     }
 
     Graph<const char*> undirected {{ // a - b - c
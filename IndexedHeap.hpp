@@ -0,0 +1,104 @@
+#pragma once
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+* IndexedHeap
+*   A binary min-heap of vertex ids in [0, n) keyed by K, which tracks the position of each id
+*   so that its key can be decreased in place: Push, Pop and DecreaseKey are all O(log n).
+*/
+template <typename K>
+class IndexedHeap {
+public:
+    using Id = std::uint32_t;
+
+    explicit IndexedHeap(std::size_t n) : position(n, absent) {}
+
+    bool Empty() const { return heap.empty(); }
+    bool Contains(Id v) const { return position[v] != absent; }
+    K Key(Id v) const { return heap[position[v]].first; }
+
+    void Push(Id v, K key);
+    void DecreaseKey(Id v, K key);
+    std::pair<Id, K> Pop();
+
+private:
+    void Up(std::size_t i);
+    void Down(std::size_t i);
+    void Place(std::size_t i, std::pair<K, Id> entry);
+
+    static constexpr Id absent = ~Id{};
+
+    std::vector<std::pair<K, Id>> heap;
+    std::vector<Id> position;
+};
+
+template <typename K>
+void IndexedHeap<K>::Push(Id v, K key)
+{
+    heap.emplace_back(key, v);
+    position[v] = static_cast<Id>(heap.size() - 1);
+    Up(heap.size() - 1);
+}
+
+template <typename K>
+void IndexedHeap<K>::DecreaseKey(Id v, K key)
+{
+    heap[position[v]].first = key;
+    Up(position[v]);
+}
+
+template <typename K>
+std::pair<typename IndexedHeap<K>::Id, K> IndexedHeap<K>::Pop()
+{
+    auto [key, v] = heap.front();
+    position[v] = absent;
+    if (heap.size() > 1) {
+        Place(0, heap.back());
+        heap.pop_back();
+        Down(0);
+    }
+    else {
+        heap.pop_back();
+    }
+    return { v, key };
+}
+
+template <typename K>
+void IndexedHeap<K>::Up(std::size_t i)
+{
+    auto entry = heap[i];
+    while (i > 0) {
+        std::size_t parent = (i - 1) / 2;
+        if (!(entry.first < heap[parent].first)) {
+            break;
+        }
+        Place(i, heap[parent]);
+        i = parent;
+    }
+    Place(i, entry);
+}
+
+template <typename K>
+void IndexedHeap<K>::Down(std::size_t i)
+{
+    auto entry = heap[i];
+    for (std::size_t child; (child = 2 * i + 1) < heap.size(); i = child) {
+        if (child + 1 < heap.size() && heap[child + 1].first < heap[child].first) {
+            ++child;
+        }
+        if (!(heap[child].first < entry.first)) {
+            break;
+        }
+        Place(i, heap[child]);
+    }
+    Place(i, entry);
+}
+
+template <typename K>
+void IndexedHeap<K>::Place(std::size_t i, std::pair<K, Id> entry)
+{
+    heap[i] = entry;
+    position[entry.second] = static_cast<Id>(i);
+}
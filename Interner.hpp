@@ -0,0 +1,65 @@
+#pragma once
+#include "DenseIds.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+/**
+* Interner
+*   Numbers distinct strings 0, 1, 2, ... and keeps one copy of each, null-terminated, in an arena of its own.
+*   A graph over the ids, Graph<Interner::Id>, keeps 4 bytes in each vertex and index entry where Graph<std::string>
+*   keeps a copy of the string in both, and hashes and compares integers where Graph<const char*> runs over the
+*   characters; the names come back through String() or CString().
+*   Neither copyable nor movable: the strings stay where they were first put.
+*/
+class Interner {
+public:
+    using Id = std::uint32_t;
+
+    static constexpr Id none = DenseIds<std::string_view>::none;  // Signals non-membership (Find).
+
+    explicit Interner(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) : strings{ upstream } {}
+    Interner(const Interner&) = delete;
+    Interner& operator=(const Interner&) = delete;
+
+    Id Intern(std::string_view s);  // The id of s, copying it in if new.
+    Id Find(std::string_view s) const { return ids.Find(s); }
+    std::string_view String(Id k) const { return ids.Item(k); }
+    const char* CString(Id k) const { return ids.Item(k).data(); }
+    Id Size() const { return ids.Size(); }
+
+    template <typename S>
+    std::vector<std::vector<Id>> Intern(const std::vector<std::vector<S>>& lists);  // As Graph's constructor takes them.
+
+private:
+    std::pmr::monotonic_buffer_resource strings;
+    DenseIds<std::string_view> ids;
+};
+
+inline Interner::Id Interner::Intern(std::string_view s)
+{
+    if (Id k = ids.Find(s); k != none) {
+        return k;
+    }
+    char* copy = static_cast<char*>(strings.allocate(s.size() + 1, 1));
+    std::copy(s.begin(), s.end(), copy);
+    copy[s.size()] = '\0';
+    return ids({ copy, s.size() });
+}
+
+template <typename S>
+std::vector<std::vector<Interner::Id>> Interner::Intern(const std::vector<std::vector<S>>& lists)
+{
+    std::vector<std::vector<Id>> interned;
+    interned.reserve(lists.size());
+    for (const std::vector<S>& list : lists) {
+        std::vector<Id>& row = interned.emplace_back();
+        row.reserve(list.size());
+        for (const S& s : list) {
+            row.push_back(Intern(s));
+        }
+    }
+    return interned;
+}
@@ -4,6 +4,7 @@
 /**
 * List
 *   A doubly-/singly-linked list implementation.
+*   Nodes come from the memory resource given on construction, new/delete by default.
 */
 template <template <typename> class N, typename I>
 class List {
@@ -21,7 +22,7 @@ public:
         Node* np;
     };
 
-    List() : head{}, tail{}, size{} {}
+    explicit List(std::pmr::memory_resource* r = std::pmr::new_delete_resource()) : head{}, tail{}, size{}, resource{ r } {}
     List(const List& l);
     List(List&& l) noexcept;
     ~List();
@@ -34,25 +35,31 @@ public:
     */
     Iterator begin() { return Iterator{ head }; }
     Iterator end() { return Iterator{ tail }; }
+    Iterator begin() const { return Iterator{ head }; }
+    Iterator end() const { return Iterator{ tail }; }
     /**
     *   Inserts values at the head of the list.
     */
     Node* Insert(I&& i);
-    Node* Insert(Node* n);  // Acquire<N, I>::Instance() should be used to create a Node*.
+    Node* Insert(Node* n);  // n must come from Construct() on this list's resource, as Acquire<N, I>::Instance() does for the default.
     Handle Release(I&& i);
     void Delete(Node** n);
 
     Node* Search(const I& i);
     int Size() const { return size; }
+    void Abandon() { head = nullptr; size = 0; }   // Forgets the nodes, to be reclaimed with their resource.
 
 private:
+    void Clear();
+
     Node* head;
     Node* tail;
     int size;
+    std::pmr::memory_resource* resource;
 };
 
 template <template <typename> class N, typename I>
-List<N, I>::List(const List& l) : head{}, tail{}, size{} {
+List<N, I>::List(const List& l) : head{}, tail{}, size{}, resource{ l.resource } {
     for (Node* n = l.head; n; n = n->next) {
         Insert(I{ n->item });
     }
@@ -60,7 +67,7 @@ List<N, I>::List(const List& l) : head{}, tail{}, size{} {
 }
 
 template <template <typename> class N, typename I>
-List<N, I>::List(List&& l) noexcept : head{}, tail{}, size{} {
+List<N, I>::List(List&& l) noexcept : head{}, tail{}, size{}, resource{ l.resource } {
     if (Node* n = l.head) {
         head = n;
         size = l.size;
@@ -71,27 +78,36 @@ List<N, I>::List(List&& l) noexcept : head{}, tail{}, size{} {
 
 template <template <typename> class N, typename I>
 List<N, I>::~List() {
+    Clear();
+}
+
+template <template <typename> class N, typename I>
+List<N, I>& List<N, I>::operator=(List&& l) noexcept {
+    if (this != &l) {
+        Clear();    // Whether or not l has nodes to hand over.
+        resource = l.resource;
+        if ((head = l.head)) {
+            tail = l.tail;
+            size = l.size;
+            l.head = nullptr;
+            l.size = 0;
+        }
+    }
+    return *this;
+}
+
+template <template <typename> class N, typename I>
+void List<N, I>::Clear() {
     if (Node* n = head) {
         while (Node* m = n) { // Deletes nodes beginning with the head and stopping at the tail.
              n = n->next;
-             delete m;
+             Destroy(resource, m);
         }
         head = nullptr;
         size = 0;
     }
 }
 
-template <template <typename> class N, typename I>
-List<N, I>& List<N, I>::operator=(List&& l) noexcept {
-    if (head = l.head) {
-        tail = l.tail;
-        size = l.size;
-        l.head = nullptr;
-        l.size = 0;
-    }
-    return *this;
-}
-
 template <template <typename> class N, typename I>
 typename List<N, I>::Node* List<N, I>::Search(const I& i) {
     Node* n = head;
@@ -105,7 +121,7 @@ typename List<N, I>::Node* List<N, I>::Search(const I& i) {
 
 template <template <typename> class N, typename I>
 typename List<N, I>::Node* List<N, I>::Insert(I&& i) {
-    return Insert(Acquire<N, I>::Instance(std::forward<I>(i)).Release());
+    return Insert(Construct<Node>(resource, std::forward<I>(i)));
 }
 
 #ifndef FORWARD
@@ -162,7 +178,7 @@ void List<N, I>::Delete(Node** n) {
             m->next->prev = m->prev;
         }
         --size;
-        delete* n;
+        Destroy(resource, *n);
         *n = nullptr;
     }
 }
@@ -180,7 +196,7 @@ void List<N, I>::Delete(Node** n) {
         m->next = m->next->next;
     }
     --size;
-    delete* n;
+    Destroy(resource, *n);
     *n = nullptr;
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include "MappedFile.hpp"
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+MappedFile::MappedFile(const std::string& path)
+{
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    LARGE_INTEGER length;
+    if (GetFileSizeEx(file, &length) && length.QuadPart > 0) {
+        if (HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr)) {
+            data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            size = data ? static_cast<std::size_t>(length.QuadPart) : 0;
+            CloseHandle(mapping);   // The view keeps the mapping, and the file, open.
+        }
+    }
+    CloseHandle(file);
+}
+
+MappedFile::~MappedFile()
+{
+    if (data) {
+        UnmapViewOfFile(data);
+    }
+}
+#else
+MappedFile::MappedFile(const std::string& path)
+{
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    struct stat status;
+    if (fstat(fd, &status) == 0 && status.st_size > 0) {
+        void* p = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        if (p != MAP_FAILED) {
+            data = static_cast<const char*>(p);
+            size = static_cast<std::size_t>(status.st_size);
+        }
+    }
+    close(fd);  // The mapping keeps the file open.
+}
+
+MappedFile::~MappedFile()
+{
+    if (data) {
+        munmap(const_cast<char*>(data), size);
+    }
+}
+#endif
@@ -0,0 +1,26 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+/**
+* MappedFile
+*   A whole file mapped read-only into memory and unmapped on destruction. Nothing is read up front:
+*   pages are faulted in on first touch, and shared through the page cache with every process mapping the file.
+*   IsOpen() is false if the file is missing, empty or cannot be mapped.
+*   The system calls live in MappedFile.cpp, which keeps <windows.h> out of every file including the graph.
+*/
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path);
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+
+    bool IsOpen() const { return data != nullptr; }
+    const char* Data() const { return data; }
+    std::size_t Size() const { return size; }
+
+private:
+    const char* data = nullptr;
+    std::size_t size = 0;
+};
@@ -0,0 +1,47 @@
+#pragma once
+#include "Traversal.hpp"
+#include "Bitset.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+* MultiSourceBreadth
+*   One breadth-first search seeded with every vertex of sources at distance 0, so that dist is the distance
+*   from the nearest source and source[v] that source (the earliest listed, on ties); sources have no predecessor.
+*   Repeated sources count once.
+*
+*   for_each_edge(u, f) calls f(v) for every out-neighbour v of u.
+*/
+template <typename I, typename H, typename Edges>
+void MultiSourceBreadth(MultiSourceBfsResult<I, H>& r, const std::vector<H>& sources, const Edges& for_each_edge)
+{
+    using Status = typename BfsResult<I, H>::Status;
+
+    Bitset visited{ r.s.size() };
+    std::vector<H> Q;   // Every vertex is enqueued at most once.
+    Q.reserve(r.s.size());
+    for (H s : sources) {
+        const std::uint32_t k = VertexIndex(s);
+        if (!visited.TestAndSet(k)) {
+            r.s[k] = Status::f;
+            r.dist[k] = 0;
+            r.source[k] = s;
+            Q.push_back(s);
+        }
+    }
+    for (std::size_t head = 0; head < Q.size(); ++head) {
+        H u = Q[head];
+        const std::uint32_t i = VertexIndex(u);
+        for_each_edge(u, [&](H v) {
+            const std::uint32_t k = VertexIndex(v);
+            if (!visited.TestAndSet(k)) {
+                r.p[k] = u;
+                r.dist[k] = r.dist[i] + 1;
+                r.source[k] = r.source[i];
+                r.s[k] = Status::f;
+                Q.push_back(v);
+            }
+        });
+        r.s[i] = Status::d;
+    }
+}
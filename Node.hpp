@@ -1,37 +1,56 @@
 #pragma once
 #include <utility>
+#include <new>
+#include <memory_resource>
 
-template <typename I>
+/**
+*   Node storage drawn from a memory resource rather than new/delete (see List, Vertices).
+*/
+template <class N, typename... Args>
+N* Construct(std::pmr::memory_resource* r, Args&&... args)
+{
+    return ::new (r->allocate(sizeof(N), alignof(N))) N{ std::forward<Args>(args)... };
+}
+
+template <class N>
+void Destroy(std::pmr::memory_resource* r, N* n)
+{
+    n->~N();
+    r->deallocate(n, sizeof(N), alignof(N));
+}
+
+/**
+* BaseNode
+*   Static base of the node types N: each declares its own "I item" (and links), so that nodes carry no vtable,
+*   stay standard-layout and are destroyed without an indirect call. Nothing deletes a node through its base.
+*/
+template <typename I, class N>
 struct BaseNode {
-    I item;
-    virtual ~BaseNode() {}
 protected:
-    BaseNode(I&& i) : item{ i } {}
-
-    template <class N>
-    static N* Allocate(I&& i) { return new N{ std::move(i) }; }
+    template <class M>
+    static M* Allocate(I&& i) { return Construct<M>(std::pmr::new_delete_resource(), std::move(i)); }
 };
 
 template <typename I>
-struct DirectedNode : BaseNode<I> {
+struct DirectedNode : BaseNode<I, DirectedNode<I>> {
     DirectedNode(I&& i)
-        : BaseNode<I>(std::forward<I>(i)), next{} {}
+        : item{ std::forward<I>(i) }, next{} {}
     DirectedNode(DirectedNode&& dn) noexcept
-        : BaseNode<I>(std::forward<I>(dn.item)), next{ dn.next } {
+        : item{ std::move(dn.item) }, next{ dn.next } {
         dn.item = I{};
         dn.next = nullptr;
     }
-    ~DirectedNode() override {}
 
+    I item;
     DirectedNode* next;
 };
 
 template <typename I>
-struct BiDirectionalNode : BaseNode<I> {
+struct BiDirectionalNode : BaseNode<I, BiDirectionalNode<I>> {
     BiDirectionalNode(I&& i)
-        : BaseNode<I>(std::forward<I>(i)), next{}, prev{} {}
-    ~BiDirectionalNode() override {}
+        : item{ std::forward<I>(i) }, next{}, prev{} {}
 
+    I item;
     BiDirectionalNode* next;
     BiDirectionalNode* prev;
 };
@@ -41,7 +60,7 @@ struct HNode {
     using Node = N<I>;
     HNode(Node* n) : node{ n } {};
     HNode(HNode&& hn) : node{ hn.Release() } {}
-    ~HNode() { delete node; node = nullptr; }
+    ~HNode() { if (node) { Destroy(std::pmr::new_delete_resource(), node); } node = nullptr; }
     Node& operator*() { return *node; }
     Node* operator->() { return node; }
     Node* Release() { Node* n{ node }; node = nullptr; return n; }
@@ -51,5 +70,5 @@ struct HNode {
 template <template <typename> class N, typename I>
 struct Acquire : N<I> {
     using Node = N<I>;
-    static HNode<N, I> Instance(I&& i) { return HNode<N, I>{ typename Node::template Allocate<Node>(std::forward<I>(i)) }; }
+    static HNode<N, I> Instance(I&& i) { return HNode<N, I>{ Node::template Allocate<Node>(std::forward<I>(i)) }; }
 };
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+#include "Traversal.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+* ParallelBreadth
+*   Level-synchronous breadth-first search over the workers of a ThreadPool.
+*   Each frontier is cut into chunks that the workers claim in turn, and expanded in two passes:
+*       1. every unfound neighbour v of a frontier vertex u is claimed for the earliest such u,
+*          by compare-and-swap on claim[v] (the position of u in the frontier);
+*       2. each u takes the neighbours it won, in edge order, into its chunk of the next frontier.
+*   Chunks are concatenated in order, so dist and p match those of the serial search exactly.
+*
+*   H is the vertex handle (see BfsResult); for_each_edge(u, f) calls f(v) for every out-neighbour v of u,
+*   in the same order as the serial search, and must be safe to call concurrently.
+*/
+template <typename I, typename H, typename Edges>
+void ParallelBreadth(BfsResult<I, H>& r, H source, const Edges& for_each_edge, ThreadPool& pool)
+{
+    using Status = typename BfsResult<I, H>::Status;
+    constexpr std::uint32_t unclaimed = ~std::uint32_t{};
+    constexpr std::size_t grain = 256;  // Frontier vertices per chunk.
+
+    const std::size_t n = r.s.size();
+    std::unique_ptr<std::atomic<std::uint32_t>[]> claim{ new std::atomic<std::uint32_t>[n] };
+    for (std::size_t v = 0; v < n; ++v) {
+        claim[v].store(unclaimed, std::memory_order_relaxed);
+    }
+
+    std::vector<H> frontier{ source };
+    std::vector<std::vector<H>> next;
+    r.s[VertexIndex(source)] = Status::f;
+    r.dist[VertexIndex(source)] = 0;
+    for (int level = 1; !frontier.empty(); ++level) {
+        const std::size_t chunks = (frontier.size() + grain - 1) / grain;
+        next.assign(chunks, {});
+        std::atomic<std::size_t> cursor;
+
+        auto expand = [&](auto&& visit) {
+            cursor.store(0, std::memory_order_relaxed);
+            auto work = [&](unsigned) {
+                for (std::size_t c; (c = cursor.fetch_add(1, std::memory_order_relaxed)) < chunks;) {
+                    const std::size_t last = std::min(frontier.size(), (c + 1) * grain);
+                    for (std::size_t i = c * grain; i < last; ++i) {
+                        visit(c, static_cast<std::uint32_t>(i));
+                    }
+                }
+            };
+            if (chunks == 1) {
+                work(0);
+            }
+            else {
+                pool.Run(work);
+            }
+        };
+
+        expand([&](std::size_t, std::uint32_t i) {
+            for_each_edge(frontier[i], [&](H v) {
+                if (r.s[VertexIndex(v)] == Status::nf) {
+                    std::atomic<std::uint32_t>& c = claim[VertexIndex(v)];
+                    std::uint32_t held = c.load(std::memory_order_relaxed);
+                    while (i < held && !c.compare_exchange_weak(held, i, std::memory_order_relaxed))
+                    {}
+                }
+            });
+        });
+        expand([&](std::size_t chunk, std::uint32_t i) {
+            H u = frontier[i];
+            for_each_edge(u, [&](H v) {
+                std::uint32_t k = VertexIndex(v);
+                if (claim[k].load(std::memory_order_relaxed) == i && r.s[k] == Status::nf) {
+                    r.s[k] = Status::f;
+                    r.dist[k] = level;
+                    r.p[k] = u;
+                    next[chunk].push_back(v);
+                }
+            });
+        });
+
+        for (H u : frontier) {
+            r.s[VertexIndex(u)] = Status::d;
+        }
+        frontier.clear();
+        for (std::vector<H>& part : next) {
+            frontier.insert(frontier.end(), part.begin(), part.end());
+        }
+    }
+}
@@ -2,66 +2,66 @@
 #include "Node.hpp"
 
 /**
-* Queue Requirements:
-*   Template parameter N should
-*       possess a member "N* next" (forward lists),
-*       and (optionally) also a member "N* prev" (bidirectional lists), 
-*       and be allocated using Acquire::Instance()
+* Queue
+*   A FIFO of nodes linked through their "N* next" member, as DirectedNode and BiDirectionalNode have.
+*   Nodes come from the memory resource given on construction, new/delete by default, as in List;
+*   those still queued are handed back to it on destruction.
 */
 template <template <typename> class N, typename I>
 class Queue {
 public:
     using Node = N<I>;
 
-    Queue() : head{}, tail{}, size{} {}
+    explicit Queue(std::pmr::memory_resource* r = std::pmr::new_delete_resource()) : head{}, tail{}, size{}, resource{ r } {}
     Queue(Queue&&) noexcept;
     ~Queue(); // Deallocates any nodes in its possession.
 
-    void Enqueue(Node* n);
-    Node* Dequeue();        // Releases nodes.
+    Node* Enqueue(I&& i);   // O(1)
+    void Enqueue(Node* n);  // O(1); n must come from Construct() on this queue's resource.
+    Node* Dequeue();        // O(1); releases nodes, to be handed back through Destroy(Resource(), n).
 
     int Size() const { return size; }
+    std::pmr::memory_resource* Resource() const { return resource; }
 
 private:
-    void DeallocateQueue(Node** n);
-    
-    Node* head;  // Value-storing.
-    Node* tail;  // The condition head == tail indicates an empty queue.
+    void DeallocateQueue();
+
+    Node* head;  // Value-storing; nullptr indicates an empty queue.
+    Node* tail;  // Last node enqueued.
     int size;
+    std::pmr::memory_resource* resource;
 };
 
 template <template <typename> class N, typename I>
-Queue<N, I>::Queue(Queue&& q) noexcept : head{ q.head }, tail{ q.tail }, size(q.size) {
+Queue<N, I>::Queue(Queue&& q) noexcept : head{ q.head }, tail{ q.tail }, size(q.size), resource{ q.resource } {
     q.head = nullptr;
+    q.tail = nullptr;
     q.size = 0;
 }
 
 template <template <typename> class N, typename I>
 Queue<N, I>::~Queue() {
-    if (head != tail) {
-        DeallocateQueue(&head);
-    }
-    size = 0;
+    DeallocateQueue();
+}
+
+template <template <typename> class N, typename I>
+typename Queue<N, I>::Node* Queue<N, I>::Enqueue(I&& i) {
+    Node* n = Construct<Node>(resource, std::forward<I>(i));
+    Enqueue(n);
+    return n;
 }
 
 template <template <typename> class N, typename I>
 void Queue<N, I>::Enqueue(Node* n) {
     if (n) {
-        if (head == tail) { // Initialize the Queue.
-            head = n;
-            head->next = tail;
-        }
-        else if (head->next == tail) { // Inductive step.
-            head->next = n;
+        n->next = nullptr;
+        if (head) { // Appends behind the tail; ...
+            tail->next = n;
         }
-        else { // Search for the node preceding the tail.
-            Node* m = head->next;
-            while (m->next != tail) {
-                m = m->next;
-            }
-            m->next = n;
+        else { // ... otherwise initializes the Queue.
+            head = n;
         }
-        n->next = tail;
+        tail = n;
         ++size;
     }
 }
@@ -69,8 +69,8 @@ void Queue<N, I>::Enqueue(Node* n) {
 template <template <typename> class N, typename I>
 typename Queue<N, I>::Node* Queue<N, I>::Dequeue() {
     if (Node* temp = head) {
-        if (head = temp->next) {
-            head->next = temp->next->next;
+        if (!(head = temp->next)) {
+            tail = nullptr;
         }
         --size;
         return temp;
@@ -78,25 +78,12 @@ typename Queue<N, I>::Node* Queue<N, I>::Dequeue() {
     return nullptr;
 }
 
-#ifdef NDEBUG
-template <template <typename> class N>
-inline typename Queue<N, std::string>::Node* Queue<N, std::string>::Dequeue() {
-    if (Node* temp = head) {
-        if (head = head->next) {
-            head->next = temp->next->next;
-        }
-        --size;
-        return temp;
-    }
-    return nullptr;
-}
-#endif
-
 template <template <typename> class N, typename I>
-void Queue<N, I>::DeallocateQueue(Node** n) {
-    if (Node* m = *n; m->next != nullptr) {
-        DeallocateQueue(&m->next);
+void Queue<N, I>::DeallocateQueue() {
+    while (Node* n = head) { // Iterative, so that long queues cannot exhaust the stack.
+        head = n->next;
+        Destroy(resource, n);
     }
-    delete* n;
-    *n = nullptr;
-}
\ No newline at end of file
+    tail = nullptr;
+    size = 0;
+}
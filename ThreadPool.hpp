@@ -0,0 +1,99 @@
+#pragma once
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+* ThreadPool
+*   A fixed set of workers running one task at a time, fork-join style:
+*   Run(task) calls task(w) once for every worker w in [0, Size()) and returns once all calls have.
+*   The calling thread takes part as worker 0, so a pool of size 1 spawns no threads.
+*/
+class ThreadPool {
+public:
+    explicit ThreadPool(unsigned size = std::thread::hardware_concurrency());
+    ThreadPool(const ThreadPool&) = delete;
+    ~ThreadPool();
+
+    template <typename F>
+    void Run(F&& task);
+
+    unsigned Size() const { return static_cast<unsigned>(workers.size()) + 1; }
+
+private:
+    void Work(unsigned w);
+
+    std::vector<std::thread> workers;
+    std::function<void(unsigned)> task;
+    std::mutex m;
+    std::condition_variable start;
+    std::condition_variable done;
+    unsigned long long generation;
+    unsigned pending;
+    bool stop;
+};
+
+inline ThreadPool::ThreadPool(unsigned size)
+    : generation{}, pending{}, stop{}
+{
+    for (unsigned w = 1; w < (size ? size : 1); ++w) {
+        workers.emplace_back(&ThreadPool::Work, this, w);
+    }
+}
+
+inline ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock{ m };
+        stop = true;
+    }
+    start.notify_all();
+    for (std::thread& t : workers) {
+        t.join();
+    }
+}
+
+template <typename F>
+void ThreadPool::Run(F&& f)
+{
+    if (workers.empty()) {
+        f(0u);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock{ m };
+        task = std::ref(f);
+        pending = static_cast<unsigned>(workers.size());
+        ++generation;
+    }
+    start.notify_all();
+    f(0u);
+    std::unique_lock<std::mutex> lock{ m };
+    done.wait(lock, [this] { return pending == 0; });
+    task = nullptr;
+}
+
+inline void ThreadPool::Work(unsigned w)
+{
+    unsigned long long seen{};
+    for (;;) {
+        std::function<void(unsigned)> f;
+        {
+            std::unique_lock<std::mutex> lock{ m };
+            start.wait(lock, [&] { return stop || generation != seen; });
+            if (stop) {
+                return;
+            }
+            seen = generation;
+            f = task;
+        }
+        f(w);
+        {
+            std::lock_guard<std::mutex> lock{ m };
+            --pending;
+        }
+        done.notify_one();
+    }
+}
@@ -0,0 +1,194 @@
+#pragma once
+#include "Vertices.hpp"
+#include "Bitset.hpp"
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+/**
+* NoVertex
+*   The handle signaling an absent vertex: nullptr for Vertex<I>*, all bits set for an id.
+*/
+template <typename H>
+constexpr H NoVertex()
+{
+    if constexpr (std::is_pointer_v<H>) {
+        return nullptr;
+    }
+    else {
+        return ~H{};
+    }
+}
+
+/**
+* VertexIndex
+*   Position of a vertex in the dense arrays of a traversal result.
+*/
+template <typename H>
+std::uint32_t VertexIndex(H v)
+{
+    if constexpr (std::is_pointer_v<H>) {
+        return v->id;
+    }
+    else {
+        return static_cast<std::uint32_t>(v);
+    }
+}
+
+/**
+* PredecessorPath
+*   Follows the predecessors p from v back to the source; empty if v does not descend from the source.
+*/
+template <typename H>
+std::vector<H> PredecessorPath(const std::vector<H>& p, H source, H v)
+{
+    std::vector<H> path;
+    for (H u = v; u != NoVertex<H>(); u = p[VertexIndex(u)]) {
+        path.push_back(u);
+        if (u == source) {
+            return { path.rbegin(), path.rend() };
+        }
+    }
+    return {};
+}
+
+/**
+* BfsResult
+*   The outcome of a breadth-first search, kept apart from the graph it ran over
+*   so that any number of searches may run over the same graph at once.
+*   H is the handle recorded as predecessor: Vertex<I>* for Graph, an id for CsrGraph.
+*/
+template <typename I, typename H>
+struct BfsResult {
+    using Status = typename Vertex<I>::Status;
+
+    explicit BfsResult(std::size_t n)
+        : s(n, Status::nf), dist(n, 100000), p(n, NoVertex<H>())
+    {
+    }
+
+    Status S(H v) const { return s[VertexIndex(v)]; }
+    int Dist(H v) const { return dist[VertexIndex(v)]; }
+    H Parent(H v) const { return p[VertexIndex(v)]; }
+    bool Found(H v) const { return S(v) != Status::nf; }
+    std::vector<H> ShortestPath(H source, H v) const { return PredecessorPath(p, source, v); }
+
+    std::vector<Status> s;
+    std::vector<int> dist;
+    std::vector<H> p;
+};
+
+/**
+* MultiSourceBfsResult
+*   The outcome of a breadth-first search from several sources at once (see MultiSourceBreadth):
+*   dist and p lead back to the nearest source, recorded per vertex in source.
+*/
+template <typename I, typename H>
+struct MultiSourceBfsResult : BfsResult<I, H> {
+    explicit MultiSourceBfsResult(std::size_t n)
+        : BfsResult<I, H>(n), source(n, NoVertex<H>())
+    {
+    }
+
+    H Source(H v) const { return source[VertexIndex(v)]; }
+
+    std::vector<H> source;
+};
+
+/**
+* BatchBfsResult
+*   The distances found by breadth-first searches from each of sources (see BatchBreadth):
+*   dist[k][VertexIndex(v)] is the distance from sources[k] to v, or unreached.
+*/
+template <typename I, typename H>
+struct BatchBfsResult {
+    static constexpr int unreached = 100000;
+
+    BatchBfsResult(std::size_t n, std::vector<H> sources)
+        : sources(std::move(sources)), dist(this->sources.size(), std::vector<int>(n, unreached))
+    {
+    }
+
+    int Dist(std::size_t k, H v) const { return dist[k][VertexIndex(v)]; }
+    bool Found(std::size_t k, H v) const { return Dist(k, v) != unreached; }
+
+    std::vector<H> sources;
+    std::vector<std::vector<int>> dist;
+};
+
+/**
+* DijkstraResult
+*   The outcome of a weighted shortest-path search (see BfsResult).
+*   Settled vertices are discovered (d); vertices still queued when the search stopped early are found (f).
+*/
+template <typename I, typename H>
+struct DijkstraResult {
+    using Status = typename Vertex<I>::Status;
+    static constexpr double unreached = std::numeric_limits<double>::infinity();
+
+    explicit DijkstraResult(std::size_t n)
+        : s(n, Status::nf), dist(n, unreached), p(n, NoVertex<H>())
+    {
+    }
+
+    Status S(H v) const { return s[VertexIndex(v)]; }
+    double Dist(H v) const { return dist[VertexIndex(v)]; }
+    H Parent(H v) const { return p[VertexIndex(v)]; }
+    bool Settled(H v) const { return S(v) == Status::d; }
+    std::vector<H> ShortestPath(H source, H v) const { return PredecessorPath(p, source, v); }
+
+    std::vector<Status> s;
+    std::vector<double> dist;
+    std::vector<H> p;
+};
+
+/**
+* DirectionOptimizing
+*   Switching thresholds of the direction-optimizing breadth-first search (Beamer et al.):
+*   expansion turns bottom-up once the edges leaving the frontier exceed 1/alpha of the edges
+*   still unexplored, and back top-down once the frontier holds fewer than 1/beta of all vertices.
+*/
+struct DirectionOptimizing {
+    int alpha = 15;
+    int beta = 18;
+};
+
+/**
+* Bidirectional
+*   Selects the point-to-point form of ShortestPath(s, v), which searches from both ends at once
+*   (see BidirectionalBreadth) instead of relying on a full breadth-first search from s.
+*/
+struct Bidirectional {};
+
+/**
+* Dynamic
+*   Selects the form of the in-place Graph::Breadth(s) that keeps its breadth-first tree current
+*   as edges and vertices come and go, repairing only the vertices whose distance may change.
+*/
+struct Dynamic {};
+
+/**
+* DfsResult
+*   The outcome of a depth-first search (see BfsResult).
+*/
+template <typename I, typename H>
+struct DfsResult {
+    using Status = typename Vertex<I>::Status;
+
+    explicit DfsResult(std::size_t n)
+        : s(n, Status::nf), t_found(n), t_disc(n), p(n, NoVertex<H>())
+    {
+    }
+
+    Status S(H v) const { return s[VertexIndex(v)]; }
+    int TimeFound(H v) const { return t_found[VertexIndex(v)]; }
+    int TimeDiscovered(H v) const { return t_disc[VertexIndex(v)]; }
+    H Parent(H v) const { return p[VertexIndex(v)]; }
+
+    std::vector<Status> s;
+    std::vector<int> t_found;
+    std::vector<int> t_disc;
+    std::vector<H> p;
+};
@@ -1,205 +1,425 @@
 #pragma once
 #include "Node.hpp"
 #include <unordered_map>
+#include <memory_resource>
+#include <algorithm>
 #include <vector>
 #include <string>
+#include <string_view>
+#include <functional>
+#include <cstring>
+#include <cstdint>
 #include <type_traits>
 #include <iostream>
 #include <sstream>
 #include <iomanip>
 
 template <typename I>
-struct Vertex : BaseNode<I> {
+struct Vertex : BaseNode<I, Vertex<I>> {
     enum Status { nf, f, d };   // Not found, found, discovered.
 
+    static constexpr std::uint32_t none = ~std::uint32_t{};   // Signals an absent predecessor.
+
     Vertex(I&& i)
-        : BaseNode<I>(std::forward<I>(i)),
-          s{}, dist{}, t_found{}, t_disc{}, p{}, next{}, prev{}
+        : item{ std::forward<I>(i) },
+          s{}, dist{}, t_found{}, t_disc{}, id{}, p{ none }
     {
     }
-    ~Vertex() = default;
-    bool operator==(const Vertex& v) const { return this->item == v.item; }
-    bool operator!=(const Vertex& v) const { return !(this->item == v.item); }
-    bool IncidentTo(Vertex* v) { return this == v->p; }
-    bool IncidentFrom(Vertex* v) { return v == p; }
-    void ShortestPath(Vertex* v, std::vector<Vertex*>&);
+    bool operator==(const Vertex& v) const { return item == v.item; }
+    bool operator!=(const Vertex& v) const { return !(item == v.item); }
+    bool IncidentTo(Vertex* v) { return id == v->p; }
+    bool IncidentFrom(Vertex* v) { return v->id == p; }
     static void Reset(Vertex*, bool);
 
+    I item;
     Status s;
-    int dist;     // Distance        -> Graph::Breadth()
-    int t_found;  // Time found      -> Graph::Depth()
-    int t_disc;   // Time discovered -> Graph::Depth()
-    Vertex* p; // Predecessor
-    Vertex* next;
-    Vertex* prev;
+    int dist;     // Distance        -> Graph::BreadthInPlace()
+    int t_found;  // Time found      -> Graph::DepthInPlace()
+    int t_disc;   // Time discovered -> Graph::DepthInPlace()
+    std::uint32_t id; // Position in the vertex set; indexes the adjacency and traversal results.
+    std::uint32_t p;  // Predecessor, by id.
 };
 
-template <typename I>
-void Vertex<I>::ShortestPath(Vertex* v, std::vector<Vertex*>& path)
-{
-    if (v == this) {
-        path.push_back(this);
-    }
-    else if (v == nullptr) {
-        path.clear();
-    }
-    else {
-        ShortestPath(v->p, path);
-        if (!path.empty()) {
-            path.push_back(v);
-        }
-    }
-}
-
 template <typename I>
 void Vertex<I>::Reset(Vertex* v, bool source)
 {
     if (source) {
         v->s = Vertex::Status::f;
         v->dist = 0;
-        v->p = nullptr;
+        v->p = none;
     }
     else {
         v->dist = 100000;
         v->s = Vertex::Status::nf;
         v->t_disc = 0;
         v->t_found = 0;
-        v->p = nullptr;
+        v->p = none;
     }
 }
 
 template <typename T>
 using V = Vertex<T>;
 
+/**
+* ItemHash, ItemEqual
+*   Default hasher and equality predicate of the item -> vertex index.
+*   C-strings are hashed and compared by content rather than by address.
+*/
 template <typename I>
-class GraphList;
+struct ItemHash : std::hash<I> {};
+
+template <>
+struct ItemHash<const char*> {
+    size_t operator()(const char* s) const { return std::hash<std::string_view>{}(s); }
+};
 
 template <typename I>
+struct ItemEqual : std::equal_to<I> {};
+
+template <>
+struct ItemEqual<const char*> {
+    bool operator()(const char* a, const char* b) const { return a == b || std::strcmp(a, b) == 0; }
+};
+
+template <typename I, typename Equal = ItemEqual<I>>
+class GraphList;
+
+/**
+* Degrees
+*   In- and out-degree of every vertex, indexed by Vertex::id.
+*/
+struct Degrees {
+    std::vector<int> in;
+    std::vector<int> out;
+};
+
+/**
+* Vertices
+*   The vertex set of a graph with its adjacency lists, item index and edge weights.
+*   Each vertex's id is its position in set, and the adjacency lists are kept in the same order, so that finding
+*   a vertex's edges is an array access.
+*   Ids close up behind a removed vertex: RemoveVertex() renumbers every vertex after it, in O(V) on top of the
+*   edges it drops, and any id taken before -- indices into a traversal result or DegreeDistribution(),
+*   the numbering of a CsrGraph from Freeze() -- no longer names the same vertex.
+*   After KeepReverse() the in-edges of every vertex are kept in lists of their own alongside the out-edges,
+*   which makes Transpose() an O(1) exchange of the two and lets InEdges() walk the edges into a vertex.
+*/
+template <typename I, typename Hash = ItemHash<I>, typename Equal = ItemEqual<I>>
 class Vertices {
 public:
-    using List = GraphList<I>;
+    using List = GraphList<I, Equal>;
     using Vertex = Vertex<I>;
-    using Edges = std::unordered_map<Vertex*, List>;
+    using Adjacency = std::pmr::vector<List>;  // By Vertex::id.
+    using Index = std::pmr::unordered_map<I, Vertex*, Hash, Equal>;
+    using Edge = std::pair<const Vertex*, const Vertex*>;
 
-    Vertices(int t)
-        : set{}, total{ t + 1 }, count{}
+    Vertices(int t, std::pmr::memory_resource* r = std::pmr::new_delete_resource())
+        : set{}, resource{ r }, edges{ r }, index{ r }, in_edges{ r }, absent{ r }
     {
-        edges[nullptr]; // Signals non-membership of a queried vertex.
+        edges.reserve(t);
+        index.reserve(t);
     }
     Vertices(Vertices&& v) noexcept;
     List& operator[](Vertex*);
+    const List& Edges(const Vertex*) const;
+    const List& InEdges(const Vertex*) const;   // Requires Reversible().
     auto begin() { return set.begin(); }
     auto end() { return set.end(); }
 
-    void AddRelations(Vertex*, const std::vector<I>&);
-    void AddVertex(Vertex*, const std::vector<I>&);
+    void AddRelations(Vertex*, const std::vector<Vertex*>&);
+    void AddRelations(Vertex*, Vertex* const* first, Vertex* const* last);  // Looks up the list of v once for the whole range.
+    void AddVertex(Vertex*, const std::vector<Vertex*>& = {});
     void RemoveRelation(Vertex* source, Vertex* relation);
-    void RemoveVertex(Vertex*);
+    void SetWeight(const Vertex* source, const Vertex* relation, double w);
+    double Weight(const Vertex* source, const Vertex* relation) const;  // 1 unless set otherwise.
+    bool Weighted() const { return !weights.empty(); }
+    void RemoveVertex(Vertex*); // O(V) and more: renumbers every vertex after v (see above).
     void ShortestPath(Vertex* s, Vertex* v, std::vector<Vertex*>&);
     void Transpose();
-    Vertex* Search(const I&);
+    void KeepReverse();
+    bool Reversible() const { return reverse; }
+    std::pmr::memory_resource* Resource() const { return resource; }  // Of the adjacency lists and their nodes.
+    void Abandon(); // Forgets every edge, to be reclaimed with the resource.
+    Vertex* Search(const I&) const; // Average O(1) through the item index.
+    bool Contains(const Vertex* v) const { return v && v->id < set.size() && set[v->id] == v; }
+    Vertex* Parent(const Vertex* v) const { return v->p == Vertex::none ? nullptr : set[v->p]; }
     int Size() { return set.size(); }
+    int InDegree(const Vertex* v) const { return reverse ? InEdges(v).Size() : in_degree[v->id]; }
+    Degrees DegreeDistribution() const;
 
     std::vector<Vertex*> set;
 
 private:
-    Edges edges;
-    int total;  // == |edges|
-    int count;  // Running total.
+    Edge Key(const Vertex* s, const Vertex* v) const { return transposed ? Edge{ v, s } : Edge{ s, v }; }
+    void Renumber(std::uint32_t removed);   // Closes up the ids, and predecessors, behind a removed vertex.
+
+    struct EdgeHash {
+        size_t operator()(const Edge& e) const { return std::hash<const Vertex*>{}(e.first) * 31 ^ std::hash<const Vertex*>{}(e.second); }
+    };
+
+    std::pmr::memory_resource* resource;
+    Adjacency edges;
+    Index index;
+    Adjacency in_edges;         // Only if reverse.
+    List absent;                // Signals non-membership of a queried vertex.
+    std::unordered_map<Edge, double, EdgeHash> weights; // Only edges weighing other than 1, so unweighted graphs pay nothing.
+    std::vector<int> in_degree; // Parallel to set, kept up to date by every change to the edges, unless reverse.
+    bool reverse = false;
+    bool transposed = false;    // Weights are keyed as before the last odd number of transpositions.
 };
 
-template <typename I>
-Vertices<I>::Vertices(Vertices&& v) noexcept
-    : edges{ std::move(v.edges) }, set{ std::move(v.set) }, total{ v.total }, count{ v.count }
+template <typename I, typename Hash, typename Equal>
+Vertices<I, Hash, Equal>::Vertices(Vertices&& v) noexcept
+    : set{ std::move(v.set) }, resource{ v.resource }, edges{ std::move(v.edges) }, index{ std::move(v.index) }, in_edges{ std::move(v.in_edges) },
+      absent{ v.resource }, weights{ std::move(v.weights) }, in_degree{ std::move(v.in_degree) }, reverse{ v.reverse }, transposed{ v.transposed }
 {
-    v.total = 0;
-    v.count = 0;
 }
 
-template <typename I>
-GraphList<I>& Vertices<I>::operator[](Vertex* v)
+template <typename I, typename Hash, typename Equal>
+GraphList<I, Equal>& Vertices<I, Hash, Equal>::operator[](Vertex* v)
 {
-    try {
-        return edges.at(v);
+    return Contains(v) ? edges[v->id] : absent;
+}
+
+template <typename I, typename Hash, typename Equal>
+const GraphList<I, Equal>& Vertices<I, Hash, Equal>::Edges(const Vertex* v) const
+{
+    return Contains(v) ? edges[v->id] : absent;
+}
+
+template <typename I, typename Hash, typename Equal>
+const GraphList<I, Equal>& Vertices<I, Hash, Equal>::InEdges(const Vertex* v) const
+{
+    return Contains(v) ? in_edges[v->id] : absent;
+}
+
+template <typename I, typename Hash, typename Equal>
+void Vertices<I, Hash, Equal>::AddRelations(Vertex* v, const std::vector<Vertex*>& incidentals)
+{
+    AddRelations(v, incidentals.data(), incidentals.data() + incidentals.size());
+}
+
+template <typename I, typename Hash, typename Equal>
+void Vertices<I, Hash, Equal>::AddRelations(Vertex* v, Vertex* const* first, Vertex* const* last)
+{
+    if (first != last) {
+        List& list = edges[v->id];
+        for (; first != last; ++first) {
+            Vertex* u = *first;
+            list.Insert(std::move(u));
+            if (reverse) {
+                in_edges[u->id].Insert(std::move(v));
+            }
+            else {
+                ++in_degree[u->id];
+            }
+        }
+    }
+}
+
+template <typename I, typename Hash, typename Equal>
+void Vertices<I, Hash, Equal>::AddVertex(Vertex* v, const std::vector<Vertex*>& incidentals)
+{
+    v->id = static_cast<std::uint32_t>(set.size());
+    set.push_back(v);
+    edges.emplace_back(resource);
+    if (reverse) {
+        in_edges.emplace_back(resource);
+    }
+    else {
+        in_degree.push_back(0);
     }
-    catch (std::out_of_range& /*re*/) {
-        if (count < total) {
-            return edges[v];
+    index.emplace(v->item, v);
+    AddRelations(v, incidentals);
+}
+
+template <typename I, typename Hash, typename Equal>
+void Vertices<I, Hash, Equal>::RemoveRelation(Vertex* s, Vertex* v)
+{
+    if (Contains(s) && edges[s->id].RemoveRelation(v)) {
+        if (reverse) {
+            in_edges[v->id].RemoveRelation(s);
         }
         else {
-            return edges.at(nullptr);
+            --in_degree[v->id];
         }
-    };
+    }
+    if (!weights.empty() && !(Contains(s) && edges[s->id].Search(v->item))) {  // The weight stays with a parallel edge.
+        weights.erase(Key(s, v));
+    }
 }
 
-template <typename I>
-void Vertices<I>::AddRelations(Vertex* v, const std::vector<I>& incidentals)
+template <typename I, typename Hash, typename Equal>
+void Vertices<I, Hash, Equal>::SetWeight(const Vertex* s, const Vertex* v, double w)
 {
-    if (!incidentals.empty()) {
-        ++count;
-        for (I item : incidentals) {
-            edges[v].Insert(I{ item });
-        }
+    if (w == 1) {
+        weights.erase(Key(s, v));
+    }
+    else {
+        weights[Key(s, v)] = w;
     }
 }
 
-template <typename I>
-void Vertices<I>::AddVertex(Vertex* v, const std::vector<I>& incidentals)
+template <typename I, typename Hash, typename Equal>
+double Vertices<I, Hash, Equal>::Weight(const Vertex* s, const Vertex* v) const
 {
-    AddRelations(v, incidentals);
-    edges[v].set = &set;
-    set.push_back(v);
+    if (!weights.empty()) {
+        if (auto it = weights.find(Key(s, v)); it != weights.end()) {
+            return it->second;
+        }
+    }
+    return 1;
 }
 
-template <typename I>
-void Vertices<I>::RemoveRelation(Vertex* s, Vertex* v)
+template <typename I, typename Hash, typename Equal>
+void Vertices<I, Hash, Equal>::RemoveVertex(Vertex* v)
 {
-    edges[s].RemoveRelation(v);
+    if (Contains(v)) {
+        auto forget = [this](const Vertex* s, const Vertex* u) {  // Weights are kept only for edges held.
+            if (!weights.empty()) {
+                weights.erase(Key(s, u));
+            }
+        };
+        for (Vertex* u : edges[v->id]) {
+            forget(v, u);
+        }
+        if (reverse) {
+            for (Vertex* u : edges[v->id]) {
+                if (u != v) {
+                    in_edges[u->id].RemoveRelation(v);
+                }
+            }
+            for (Vertex* u : in_edges[v->id]) {
+                if (u != v) {
+                    edges[u->id].RemoveRelation(v);
+                    forget(u, v);
+                }
+            }
+            in_edges.erase(in_edges.begin() + v->id);
+        }
+        else {
+            for (Vertex* u : edges[v->id]) {
+                --in_degree[u->id];
+            }
+            for (auto u : set) {
+                if (u != v) {
+                    while (edges[u->id].RemoveRelation(v)) {    // Parallel edges hold v more than once.
+                        forget(u, v);
+                    }
+                }
+            }
+            in_degree.erase(in_degree.begin() + v->id);
+        }
+        edges.erase(edges.begin() + v->id);
+        index.erase(v->item);
+        set.erase(set.begin() + v->id);
+        Renumber(v->id);
+    }
 }
 
-template <typename I>
-void Vertices<I>::RemoveVertex(Vertex* v)
+template <typename I, typename Hash, typename Equal>
+void Vertices<I, Hash, Equal>::Renumber(std::uint32_t removed)
 {
-    if (edges.erase(v)) {
-        for (auto u : set) {
-            if (u != v) {
-                RemoveRelation(u, v);
-            }
+    for (Vertex* u : set) {
+        if (u->id > removed) {
+            --u->id;
+        }
+        if (u->p == removed) {
+            u->p = Vertex::none;
+        }
+        else if (u->p != Vertex::none && u->p > removed) {
+            --u->p;
         }
-        set.erase(std::remove_if(set.begin(), set.end(),
-            [&](Vertex* u) { return u == v; }), set.end());
-        --total;
     }
 }
 
-template <typename I>
-void Vertices<I>::ShortestPath(Vertex* s, Vertex* v, std::vector<Vertex*>& path)
+/**
+*   Appends the predecessors leading from s to v, or clears the path if v does not descend from s.
+*/
+template <typename I, typename Hash, typename Equal>
+void Vertices<I, Hash, Equal>::ShortestPath(Vertex* s, Vertex* v, std::vector<Vertex*>& path)
 {
-    s->ShortestPath(Search(v->item), path);
+    const auto start = path.size();
+    for (Vertex* u = Search(v->item); u; u = Parent(u)) {
+        path.push_back(u);
+        if (u == s) {
+            std::reverse(path.begin() + start, path.end());
+            return;
+        }
+    }
+    path.clear();
 }
 
-template <typename I>
-void Vertices<I>::Transpose()
+template <typename I, typename Hash, typename Equal>
+void Vertices<I, Hash, Equal>::Transpose()
 {
-    std::unordered_map<Vertex*, List> edges_t;
-    edges_t[nullptr];
-    for (auto k : set) {        // Accounts for vertices with only incident edges (directed graphs)
-        edges_t[k].set = &set; //<-and initializes all 'set' pointers.
-        for (Vertex* v : edges[k]) {
-            edges_t[v].Insert(I{ k->item });
+    transposed = !transposed;
+    if (reverse) {
+        std::swap(edges, in_edges);
+        return;
+    }
+    Adjacency edges_t{ resource };
+    edges_t.reserve(set.size());
+    for (std::size_t k = 0; k < set.size(); ++k) {
+        edges_t.emplace_back(resource);
+    }
+    for (Vertex* k : set) {
+        in_degree[k->id] = edges[k->id].Size();
+        for (Vertex* v : edges[k->id]) {
+            edges_t[v->id].Insert(std::move(k));
         }
     }
     edges = std::move(edges_t);
 }
 
-template <typename I>
-V<I>* Vertices<I>::Search(const I& item)
+template <typename I, typename Hash, typename Equal>
+void Vertices<I, Hash, Equal>::KeepReverse()
 {
-    for (auto v : set) {
-        if (v->item == item) {
-            return v;
+    if (reverse) {
+        return;
+    }
+    in_edges.reserve(set.size());
+    for (std::size_t k = 0; k < set.size(); ++k) {
+        in_edges.emplace_back(resource);
+    }
+    for (Vertex* k : set) {
+        for (Vertex* v : edges[k->id]) {
+            in_edges[v->id].Insert(std::move(k));
         }
     }
+    in_degree.clear();
+    in_degree.shrink_to_fit();
+    reverse = true;
+}
+
+template <typename I, typename Hash, typename Equal>
+void Vertices<I, Hash, Equal>::Abandon()
+{
+    for (List& list : edges) {
+        list.Abandon();
+    }
+    for (List& list : in_edges) {
+        list.Abandon();
+    }
+}
+
+template <typename I, typename Hash, typename Equal>
+Degrees Vertices<I, Hash, Equal>::DegreeDistribution() const
+{
+    Degrees d{ std::vector<int>(set.size()), std::vector<int>(set.size()) };
+    for (Vertex* v : set) {
+        d.in[v->id] = InDegree(v);
+        d.out[v->id] = Edges(v).Size();
+    }
+    return d;
+}
+
+template <typename I, typename Hash, typename Equal>
+V<I>* Vertices<I, Hash, Equal>::Search(const I& item) const
+{
+    if (auto it = index.find(item); it != index.end()) {
+        return it->second;
+    }
     return nullptr;
 }
 
@@ -256,7 +476,7 @@ std::vector<std::string> Summary<I>::Summarize(Vertex* v) const
     const auto distance        = std::to_string(v->dist);
     const auto time_found      = std::to_string(v->t_found);
     const auto time_discovered = std::to_string(v->t_disc);
-    const auto parent          = v->p ? SafeStringConversion(v->p) : string{ default_char };
+    const auto parent          = v->p != Vertex::none ? SafeStringConversion(vertices[v->p]) : string{ default_char };
     string status{};
     switch (v->s) {
     case Vertex::Status::nf: {